@@ -0,0 +1,54 @@
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "BenchApp.h"
+#include "Benchmark.h"
+#include "engine/AI/AIService.h"
+#include "engine/core/debug/Log.h"
+#include "game/components/Controllers/AIController.h"
+
+using glm::vec3;
+using std::vector;
+
+// Index ResetForNextLap starts from, the path needs to be longer than this
+static constexpr size_t kMinPathLength = 80;
+
+class AIControllerBenchmark
+{
+  public:
+    static void SetPath(AIController& controller, const vector<vec3>& path)
+    {
+        controller.path_to_follow_ = path;
+    }
+
+    // Pretends the kart has reached its current waypoint
+    static void ReachWaypoint(AIController& controller)
+    {
+        const vec3& waypoint =
+            controller.path_to_follow_[controller.next_path_index_];
+        controller.NextWaypoint(waypoint, waypoint);
+    }
+};
+
+void RunAIBenchmarks(BenchmarkRunner& runner, BenchApp& app)
+{
+    AIService& ai_service = app.GetServiceProvider().GetService<AIService>();
+    const vector<vec3> path = ai_service.GetPath();
+
+    if (path.size() < kMinPathLength)
+    {
+        debug::LogWarn("AI path too short ({}), skipping AI benchmarks",
+                       path.size());
+        return;
+    }
+
+    // Never initialized as a component, only the path following state is used
+    AIController controller;
+    AIControllerBenchmark::SetPath(controller, path);
+
+    // One sample is a full lap of waypoints
+    runner.Run(
+        "AIController::NextWaypoint", 50, static_cast<uint32_t>(path.size()),
+        [&]() { AIControllerBenchmark::ReachWaypoint(controller); },
+        [&]() { controller.ResetForNextLap(); });
+}
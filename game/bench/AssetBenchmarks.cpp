@@ -0,0 +1,51 @@
+#include <fmt/format.h>
+
+#include "BenchApp.h"
+#include "Benchmark.h"
+#include "engine/asset/AssetService.h"
+#include "engine/prefab/PrefabService.h"
+
+static constexpr const char* kBenchMeshPath =
+    "resources/models/kart/kart2-5.gltf";
+static constexpr const char* kBenchPrefabPath =
+    "resources/prefabs/kart-human.jsonc";
+static constexpr const char* kInstantiateName =
+    "PrefabService::Instantiate (pickup)";
+
+void RunAssetBenchmarks(BenchmarkRunner& runner, BenchApp& app)
+{
+    AssetService& asset_service =
+        app.GetServiceProvider().GetService<AssetService>();
+
+    // Mesh names must be unique, so every load gets its own name
+    uint32_t load_count = 0;
+
+    runner.Run("AssetService::LoadMesh (kart)", 20, 1,
+               [&]()
+               {
+                   const std::string name =
+                       fmt::format("bench-kart-{}", load_count++);
+                   asset_service.LoadMesh(kBenchMeshPath, name);
+               });
+
+    PrefabService& prefab_service =
+        app.GetServiceProvider().GetService<PrefabService>();
+
+    runner.Run("PrefabService::LoadPrefabFile (kart-human)", 50, 1,
+               [&]() { prefab_service.LoadPrefabFile(kBenchPrefabPath); });
+
+    if (runner.ShouldRun(kInstantiateName))
+    {
+        // Pickups pile up in a scene of their own, until the next suite loads
+        Scene* scene = nullptr;
+        app.LoadScene("Bench-Prefabs",
+                      [&](Scene& loaded_scene) { scene = &loaded_scene; });
+
+        runner.Run(kInstantiateName, 100, 10,
+                   [&]()
+                   {
+                       DoNotOptimize(prefab_service.Instantiate(
+                           *scene, "pickup-double-damage"));
+                   });
+    }
+}
@@ -0,0 +1,79 @@
+#include "BenchApp.h"
+
+#include "engine/AI/AIService.h"
+#include "engine/asset/AssetService.h"
+#include "engine/audio/AudioService.h"
+#include "engine/core/debug/Log.h"
+#include "engine/input/InputService.h"
+#include "engine/physics/PhysicsService.h"
+#include "engine/pickup/PickupService.h"
+#include "engine/prefab/PrefabService.h"
+#include "engine/scene/ComponentUpdateService.h"
+#include "engine/scene/SceneSnapshotService.h"
+#include "game/GamePrefabs.h"
+#include "game/GameSystems.h"
+#include "game/services/GameStateService.h"
+
+using std::string;
+
+BenchApp::BenchApp(BenchmarkRunner& runner)
+    : App(AppOptions{.headless = true}),
+      runner_(runner),
+      scene_loader_()
+{
+}
+
+void BenchApp::LoadScene(const string& name,
+                         const std::function<void(Scene&)>& loader)
+{
+    if (!GetSceneList().HasScene(name))
+    {
+        AddScene(name);
+    }
+
+    scene_loader_ = loader;
+    SetActiveScene(name);
+
+    // Scene changes are applied at the start of a frame
+    RunFrame();
+    scene_loader_ = nullptr;
+}
+
+void BenchApp::OnInit()
+{
+    // Same set of services as a headless GameApp
+    AddService<AssetService>();
+    AddService<PrefabService>();
+    AddService<InputService>();
+    AddService<PhysicsService>();
+    AddService<ComponentUpdateService>();
+    AddService<SceneSnapshotService>();
+    AddService<AudioService>();
+    AddService<AIService>();
+    AddService<GameStateService>();
+    AddService<PickupService>();
+}
+
+void BenchApp::OnStart()
+{
+    RegisterGameSystems(
+        GetServiceProvider().GetService<ComponentUpdateService>());
+    RegisterGameSnapshots(
+        GetServiceProvider().GetService<SceneSnapshotService>());
+    LoadGamePrefabs(GetServiceProvider().GetService<PrefabService>());
+
+    RunCoreBenchmarks(runner_, *this);
+    RunAssetBenchmarks(runner_, *this);
+    RunAIBenchmarks(runner_, *this);
+    RunSceneBenchmarks(runner_, *this);
+
+    Quit();
+}
+
+void BenchApp::OnSceneLoaded(Scene& scene)
+{
+    if (scene_loader_)
+    {
+        scene_loader_(scene);
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "Benchmark.h"
+#include "engine/App.h"
+
+/**
+ * Headless app with the simulation services registered. All benchmark suites
+ * run from OnStart, after which the app quits without entering the game loop
+ */
+class BenchApp : public App
+{
+  public:
+    BenchApp(BenchmarkRunner& runner);
+
+    // Suites drive scenes and frames themselves
+    using App::AddScene;
+    using App::GetServiceProvider;
+    using App::RunFrame;
+
+    // Switches scenes immediately, calling `loader` to populate the new one
+    void LoadScene(const std::string& name,
+                   const std::function<void(Scene&)>& loader);
+
+  protected:
+    // From App
+    void OnInit() override;
+    void OnStart() override;
+    void OnSceneLoaded(Scene& scene) override;
+
+  private:
+    BenchmarkRunner& runner_;
+    std::function<void(Scene&)> scene_loader_;
+};
@@ -0,0 +1,90 @@
+// GLEW must be included before GLFW
+
+// clang-format off
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+// clang-format on
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "BenchApp.h"
+#include "Benchmark.h"
+#include "engine/core/debug/Assert.h"
+#include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
+
+using std::string;
+
+/**
+ * Usage: game_bench [--filter <substring>] [--csv <path>] [--frames <count>]
+ *                   [--gl]
+ *
+ * --gl also runs the benchmarks that need an OpenGL context (particles)
+ */
+static BenchmarkOptions ParseArgs(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--filter" && has_value)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--csv" && has_value)
+        {
+            options.csv_path = argv[++i];
+        }
+        else if (arg == "--frames" && has_value)
+        {
+            options.scene_frames = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if (arg == "--gl")
+        {
+            options.run_gl = true;
+        }
+        else
+        {
+            debug::LogWarn("Ignoring unknown argument: {}", arg);
+        }
+    }
+
+    return options;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkRunner runner(ParseArgs(argc, argv));
+    std::srand(kBenchmarkSeed);
+
+    // Measure the engine itself, not the profiler zones wrapped around it
+    debug::Profiler::SetEnabled(false);
+
+    std::shared_ptr app = std::make_shared<BenchApp>(runner);
+    app->Run();
+
+    if (runner.GetOptions().run_gl)
+    {
+        const int glfw_status = glfwInit();
+        ASSERT_MSG(glfw_status == GLFW_TRUE, "GLFW must be initialized");
+
+        RunParticleBenchmarks(runner);
+        glfwTerminate();
+    }
+
+    runner.PrintSummary();
+
+    const string& csv_path = runner.GetOptions().csv_path;
+    if (!csv_path.empty() && !runner.WriteCsv(csv_path))
+    {
+        debug::LogError("Failed to write results to: {}", csv_path);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "Benchmark.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <numeric>
+
+#include "engine/core/debug/Log.h"
+
+using std::string;
+using std::vector;
+
+static double Percentile(const vector<double>& sorted, double p)
+{
+    const size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions& options)
+    : options_(options),
+      results_()
+{
+}
+
+bool BenchmarkRunner::ShouldRun(const string& name) const
+{
+    return options_.filter.empty() ||
+           name.find(options_.filter) != string::npos;
+}
+
+void BenchmarkRunner::Run(const string& name, uint32_t samples,
+                          uint32_t batch, const std::function<void()>& fn,
+                          const std::function<void()>& setup)
+{
+    if (!ShouldRun(name))
+    {
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    vector<double> samples_ns;
+    samples_ns.reserve(samples);
+
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        if (setup)
+        {
+            setup();
+        }
+
+        const auto start = Clock::now();
+        for (uint32_t j = 0; j < batch; j++)
+        {
+            fn();
+        }
+        const auto end = Clock::now();
+
+        const double elapsed_ns =
+            std::chrono::duration<double, std::nano>(end - start).count();
+        samples_ns.push_back(elapsed_ns / batch);
+    }
+
+    AddResult(name, std::move(samples_ns));
+}
+
+void BenchmarkRunner::AddResult(const string& name, vector<double> samples_ns)
+{
+    if (samples_ns.empty())
+    {
+        return;
+    }
+
+    std::sort(samples_ns.begin(), samples_ns.end());
+    const double total =
+        std::accumulate(samples_ns.begin(), samples_ns.end(), 0.0);
+
+    BenchmarkResult result{.name = name,
+                           .samples = samples_ns.size(),
+                           .mean_ns = total / samples_ns.size(),
+                           .p50_ns = Percentile(samples_ns, 0.50),
+                           .p90_ns = Percentile(samples_ns, 0.90),
+                           .p99_ns = Percentile(samples_ns, 0.99),
+                           .max_ns = samples_ns.back()};
+
+    debug::LogInfo("{:<48} mean {:>12.1f} ns   p99 {:>12.1f} ns", name,
+                   result.mean_ns, result.p99_ns);
+    results_.push_back(result);
+}
+
+void BenchmarkRunner::PrintSummary() const
+{
+    fmt::print("\n{:<48} {:>8} {:>12} {:>12} {:>12} {:>12} {:>12}\n",
+               "Benchmark", "Samples", "Mean (us)", "p50 (us)", "p90 (us)",
+               "p99 (us)", "Max (us)");
+
+    for (auto& result : results_)
+    {
+        fmt::print("{:<48} {:>8} {:>12.3f} {:>12.3f} {:>12.3f} {:>12.3f} "
+                   "{:>12.3f}\n",
+                   result.name, result.samples, result.mean_ns / 1000.0,
+                   result.p50_ns / 1000.0, result.p90_ns / 1000.0,
+                   result.p99_ns / 1000.0, result.max_ns / 1000.0);
+    }
+}
+
+bool BenchmarkRunner::WriteCsv(const string& path) const
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << "name,samples,mean_ns,p50_ns,p90_ns,p99_ns,max_ns\n";
+
+    for (auto& result : results_)
+    {
+        file << fmt::format("{},{},{:.1f},{:.1f},{:.1f},{:.1f},{:.1f}\n",
+                            result.name, result.samples, result.mean_ns,
+                            result.p50_ns, result.p90_ns, result.p99_ns,
+                            result.max_ns);
+    }
+
+    return true;
+}
+
+const BenchmarkOptions& BenchmarkRunner::GetOptions() const
+{
+    return options_;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Fixed seed so every run generates the same inputs
+static constexpr uint32_t kBenchmarkSeed = 585;
+
+// Keeps the compiler from optimizing away a benchmarked result
+template <class T>
+inline void DoNotOptimize(const T& value)
+{
+    static const void* volatile sink;
+    sink = &value;
+}
+
+struct BenchmarkOptions
+{
+    std::string filter;
+    std::string csv_path;
+    bool run_gl = false;
+    uint32_t scene_frames = 600;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    uint64_t samples;
+    double mean_ns;
+    double p50_ns;
+    double p90_ns;
+    double p99_ns;
+    double max_ns;
+};
+
+class BenchmarkRunner
+{
+  public:
+    BenchmarkRunner(const BenchmarkOptions& options);
+
+    bool ShouldRun(const std::string& name) const;
+
+    /**
+     * Times `samples` runs of `fn`, each of which calls it `batch` times.
+     * Reported numbers are per call. `setup` runs untimed before each sample.
+     */
+    void Run(const std::string& name, uint32_t samples, uint32_t batch,
+             const std::function<void()>& fn,
+             const std::function<void()>& setup = nullptr);
+
+    // For benchmarks that measure themselves (e.g. whole frames)
+    void AddResult(const std::string& name, std::vector<double> samples_ns);
+
+    void PrintSummary() const;
+    bool WriteCsv(const std::string& path) const;
+
+    const BenchmarkOptions& GetOptions() const;
+
+  private:
+    BenchmarkOptions options_;
+    std::vector<BenchmarkResult> results_;
+};
+
+/* ----- Suites ----- */
+
+class BenchApp;
+
+void RunCoreBenchmarks(BenchmarkRunner& runner, BenchApp& app);
+void RunAssetBenchmarks(BenchmarkRunner& runner, BenchApp& app);
+void RunAIBenchmarks(BenchmarkRunner& runner, BenchApp& app);
+void RunSceneBenchmarks(BenchmarkRunner& runner, BenchApp& app);
+void RunParticleBenchmarks(BenchmarkRunner& runner);
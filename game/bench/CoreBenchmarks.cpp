@@ -0,0 +1,275 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchApp.h"
+#include "Benchmark.h"
+#include "engine/core/event/ConcurrentEventQueue.h"
+#include "engine/core/event/EventBus.h"
+#include "engine/scene/Entity.h"
+#include "engine/scene/OnUpdateEvent.h"
+#include "engine/scene/Scene.h"
+#include "engine/scene/Transform.h"
+
+using glm::vec3;
+using std::vector;
+
+static constexpr uint32_t kSubscriberCounts[] = {10, 100, 1000};
+static constexpr uint32_t kComponentCount = 8;
+static constexpr uint32_t kPooledEntityCount = 1000;
+
+// Pooled entities are spread over a track-sized square for proximity queries
+static constexpr float kPooledAreaSize = 1000.0f;
+static constexpr float kQueryRadius = 50.0f;
+
+struct BenchSubscriber : public IEventSubscriber<OnUpdateEvent>
+{
+    double total_seconds = 0.0;
+
+    void OnUpdate(const Timestep& delta_time) override
+    {
+        total_seconds += delta_time.GetSeconds();
+    }
+};
+
+// Distinct component types to fill up an entity before the one being looked up
+template <uint32_t N>
+class BenchComponent final : public Component
+{
+  public:
+    void OnInit(const ServiceProvider& service_provider) override
+    {
+    }
+
+    std::string_view GetName() const override
+    {
+        return "BenchComponent";
+    }
+};
+
+template <uint32_t... N>
+static void AddBenchComponents(Entity& entity,
+                               std::integer_sequence<uint32_t, N...>)
+{
+    (entity.AddComponent<BenchComponent<N>>(), ...);
+}
+
+static void RunEventBusBenchmarks(BenchmarkRunner& runner)
+{
+    OnUpdateEvent event;
+    event.delta_time = Timestep::Seconds(1.0 / 60.0);
+
+    for (uint32_t count : kSubscriberCounts)
+    {
+        vector<BenchSubscriber> subscribers(count);
+
+        EventBus bus;
+        for (auto& subscriber : subscribers)
+        {
+            bus.Subscribe<OnUpdateEvent>(&subscriber);
+        }
+
+        runner.Run(fmt::format("EventBus::Publish/{}", count), 200, 100,
+                   [&]() { bus.Publish<OnUpdateEvent>(&event); });
+
+        // What timing every handler call adds on top
+        bus.SetStatsEnabled(true);
+        runner.Run(fmt::format("EventBus::Publish+Stats/{}", count), 200, 100,
+                   [&]() { bus.Publish<OnUpdateEvent>(&event); });
+        bus.SetStatsEnabled(false);
+
+        // The same delivery through the queue, a frame's worth at a time
+        runner.Run(fmt::format("EventBus::Post+Flush/{}", count), 200, 10,
+                   [&]()
+                   {
+                       for (uint32_t i = 0; i < 10; i++)
+                       {
+                           bus.Post<OnUpdateEvent>(event);
+                       }
+
+                       bus.Flush();
+                   });
+
+        // Again through a lock free source, as other threads would push
+        ConcurrentEventQueue<OnUpdateEvent> source(64);
+        bus.AddSource(&source);
+
+        runner.Run(fmt::format("ConcurrentEventQueue::Push+Flush/{}", count),
+                   200, 10,
+                   [&]()
+                   {
+                       for (uint32_t i = 0; i < 10; i++)
+                       {
+                           source.Push(event);
+                       }
+
+                       bus.Flush();
+                   });
+
+        bus.RemoveSource(&source);
+
+        // Unsubscribe everything in a shuffled (but seeded) order
+        EventBus unsub_bus;
+        vector<EventBus::SubscriptionId> ids;
+        std::mt19937 rng(kBenchmarkSeed);
+
+        runner.Run(
+            fmt::format("EventBus::Unsubscribe/{}", count), 20, 1,
+            [&]()
+            {
+                for (const EventBus::SubscriptionId& id : ids)
+                {
+                    unsub_bus.Unsubscribe(id);
+                }
+            },
+            [&]()
+            {
+                ids.clear();
+                for (auto& subscriber : subscribers)
+                {
+                    ids.push_back(unsub_bus.Subscribe<OnUpdateEvent>(
+                        &subscriber));
+                }
+                std::shuffle(ids.begin(), ids.end(), rng);
+            });
+    }
+}
+
+static void RunEntityBenchmarks(BenchmarkRunner& runner, BenchApp& app)
+{
+    Scene& scene = app.AddScene("Bench-Entity");
+    Entity& entity = scene.AddEntity("Bench");
+
+    // Transform goes after every other component, the worst case for a scan
+    AddBenchComponents(entity,
+                       std::make_integer_sequence<uint32_t, kComponentCount>());
+    entity.AddComponent<Transform>();
+
+    runner.Run(fmt::format("Entity::GetComponent/{}", kComponentCount + 1),
+               200, 1000,
+               [&]()
+               {
+                   DoNotOptimize(entity.GetComponent<Transform>());
+               });
+
+    runner.Run(
+        fmt::format("Entity::TryGetComponent/{} (miss)", kComponentCount + 1),
+        200, 1000,
+        [&]()
+        {
+            DoNotOptimize(
+                entity.TryGetComponent<BenchComponent<kComponentCount>>());
+        });
+
+    // UpdateMatrices is private, every setter runs it
+    Transform& transform = entity.GetComponent<Transform>();
+    float offset = 0.0f;
+
+    runner.Run("Transform::UpdateMatrices (SetPosition)", 200, 1000,
+               [&]()
+               {
+                   offset += 0.001f;
+                   transform.SetPosition(vec3(offset, 1.0f, -offset));
+               });
+
+    // Walking one component type the way per-frame systems do
+    Scene& pooled_scene = app.AddScene("Bench-Pool");
+    std::mt19937 rng(kBenchmarkSeed);
+    std::uniform_real_distribution<float> area_dist(0.0f, kPooledAreaSize);
+
+    for (uint32_t i = 0; i < kPooledEntityCount; i++)
+    {
+        Entity& pooled_entity = pooled_scene.AddEntity("Bench");
+        pooled_entity.AddComponent<Transform>().SetPosition(
+            vec3(area_dist(rng), 0.0f, area_dist(rng)));
+
+        // Half match the view below, which should only cost the matches
+        if (i % 2 == 0)
+        {
+            pooled_entity.AddComponent<BenchComponent<0>>();
+        }
+    }
+
+    runner.Run(fmt::format("Scene::ForEachComponent/{}", kPooledEntityCount),
+               200, 100,
+               [&]()
+               {
+                   pooled_scene.ForEachComponent<Transform>(
+                       [](Transform& pooled)
+                       { DoNotOptimize(pooled.GetPosition()); });
+               });
+
+    runner.Run(fmt::format("Scene::View<Transform, BenchComponent>/{}",
+                           kPooledEntityCount / 2),
+               200, 100,
+               [&]()
+               {
+                   pooled_scene.View<Transform, BenchComponent<0>>().ForEach(
+                       [](Entity& pooled_entity, Transform& pooled,
+                          BenchComponent<0>& tag)
+                       { DoNotOptimize(pooled.GetPosition()); });
+               });
+
+    // Finding what's near a point, by scanning and through the spatial index
+    const SpatialIndex& spatial_index = pooled_scene.GetSpatialIndex();
+    pooled_scene.GetSpatialIndex().Update();
+    vector<Transform*> nearby;
+
+    runner.Run(fmt::format("Scene::ForEachComponent radius scan/{}",
+                           kPooledEntityCount),
+               200, 100,
+               [&]()
+               {
+                   const vec3 center(area_dist(rng), 0.0f, area_dist(rng));
+                   nearby.clear();
+
+                   pooled_scene.ForEachComponent<Transform>(
+                       [&](Transform& pooled)
+                       {
+                           if (glm::distance(pooled.GetPosition(), center) <=
+                               kQueryRadius)
+                           {
+                               nearby.push_back(&pooled);
+                           }
+                       });
+
+                   DoNotOptimize(nearby.size());
+               });
+
+    runner.Run(fmt::format("SpatialIndex::QueryRadius/{}", kPooledEntityCount),
+               200, 100,
+               [&]()
+               {
+                   const vec3 center(area_dist(rng), 0.0f, area_dist(rng));
+                   nearby.clear();
+
+                   spatial_index.QueryRadius(center, kQueryRadius, nearby);
+                   DoNotOptimize(nearby.size());
+               });
+
+    // Filling a scene and tearing it down, like a MainMenu <-> Track1 trip
+    Scene& churn_scene = app.AddScene("Bench-Churn");
+
+    runner.Run(fmt::format("Scene::Load+Unload/{}", kPooledEntityCount), 50, 1,
+               [&]()
+               {
+                   churn_scene.Load();
+
+                   for (uint32_t i = 0; i < kPooledEntityCount; i++)
+                   {
+                       churn_scene.AddEntity("Bench").AddComponent<Transform>();
+                   }
+
+                   churn_scene.Unload();
+               });
+}
+
+void RunCoreBenchmarks(BenchmarkRunner& runner, BenchApp& app)
+{
+    RunEventBusBenchmarks(runner);
+    RunEntityBenchmarks(runner, app);
+}
@@ -0,0 +1,87 @@
+// GLEW must be included before GLFW
+
+// clang-format off
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+// clang-format on
+
+#include <fmt/format.h>
+
+#include <glm/glm.hpp>
+
+#include "Benchmark.h"
+#include "engine/core/gfx/Window.h"
+#include "engine/render/Camera.h"
+#include "engine/render/ParticleDrawList.h"
+#include "engine/render/ParticleSystem.h"
+
+using glm::mat4;
+using glm::vec3;
+using glm::vec4;
+using std::vector;
+
+static constexpr uint32_t kParticleCounts[] = {1000, 10000};
+static constexpr uint32_t kBurstAmount = 10;
+
+// Long lived so every emitted particle stays alive for the whole benchmark
+static const ParticleSystemProperties kBenchParticleProperties{
+    .acceleration = vec3(0.0f, -10.0f, 0.0f),
+    .color_start = vec4(1.0f, 0.5f, 0.0f, 1.0f),
+    .color_end = vec4(1.0f, 0.0f, 0.0f, 0.0f),
+    .random_velocity = true,
+    .velocity = vec3(0.0f, 0.0f, 0.0f),
+    .speed = 20.0f,
+    .size_start = 0.5f,
+    .size_end = 0.25f,
+    .lifetime = 1000.0f,
+    .texture = nullptr,
+    .burst_amount = kBurstAmount,
+};
+
+void RunParticleBenchmarks(BenchmarkRunner& runner)
+{
+    // Only needed for a GL context, destroyed after the draw list below
+    Window window;
+    window.Create(100, 100, "game_bench");
+
+    const CameraView camera{.pos = vec3(0.0f, 10.0f, 30.0f),
+                            .view_matrix = mat4(1.0f),
+                            .proj_matrix = mat4(1.0f),
+                            .view_proj_matrix = mat4(1.0f)};
+
+    for (uint32_t count : kParticleCounts)
+    {
+        ParticleDrawList draw_list;
+        draw_list.Init();
+
+        ParticleSystem particle_system(kBenchParticleProperties);
+        for (uint32_t i = 0; i < count / kBurstAmount; i++)
+        {
+            particle_system.Emit(vec3(0.0f, 0.0f, 0.0f));
+        }
+
+        // A zero timestep does all the work without aging the particles
+        const Timestep no_time;
+        vector<Particle> particles;
+
+        runner.Run(
+            fmt::format("ParticleSystem::Update/{}", count), 100, 1,
+            [&]() { particle_system.Update(no_time, particles); },
+            [&]() { particles.clear(); });
+
+        runner.Run(
+            fmt::format("ParticleDrawList::Prepare/{}", count), 100, 1,
+            [&]() { draw_list.Prepare(camera); },
+            [&]()
+            {
+                draw_list.Clear();
+                particles.clear();
+                particle_system.Update(no_time, particles);
+
+                for (const Particle& particle : particles)
+                {
+                    draw_list.AddParticle(particle);
+                }
+            });
+    }
+}
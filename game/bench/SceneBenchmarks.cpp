@@ -0,0 +1,268 @@
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <random>
+#include <vector>
+
+#include "BenchApp.h"
+#include "Benchmark.h"
+#include "engine/core/debug/Log.h"
+#include "engine/physics/MeshStaticBody.h"
+#include "engine/physics/PhysicsService.h"
+#include "engine/scene/ComponentUpdateService.h"
+#include "engine/scene/Scene.h"
+#include "engine/scene/SceneSnapshotService.h"
+#include "engine/scene/Transform.h"
+#include "game/components/VehicleComponent.h"
+#include "game/components/audio/AudioEmitter.h"
+
+using glm::vec3;
+using std::vector;
+
+static constexpr uint32_t kKartCounts[] = {8, 32, 128};
+static constexpr uint32_t kWarmupFrames = 60;
+static constexpr uint32_t kRestartSamples = 10;
+
+// Karts are lined up on a grid behind the start line
+static constexpr uint32_t kGridColumns = 4;
+static const vec3 kGridOrigin(-20.0f, 5.0f, 0.0f);
+static const vec3 kGridSpacing(10.0f, 0.0f, 12.0f);
+
+/**
+ * Drives forward with a slow weave so karts keep moving and colliding without
+ * depending on the race state AIController needs
+ */
+class BenchDriver final : public Component
+{
+  public:
+    void OnInit(const ServiceProvider& service_provider) override
+    {
+        vehicle_ = &GetEntity().GetComponent<VehicleComponent>();
+        vehicle_->SetGear(VehicleGear::kForward);
+    }
+
+    void OnUpdate(const Timestep& delta_time)
+    {
+        time_ += static_cast<float>(delta_time.GetSeconds());
+
+        const float steer = 0.3f * std::sin(time_ * 1.5f + phase_);
+        vehicle_->SetCommand(VehicleCommand(0.0f, 0.0f, 1.0f, steer));
+    }
+
+    std::string_view GetName() const override
+    {
+        return "BenchDriver";
+    }
+
+    void SetPhase(float phase)
+    {
+        phase_ = phase;
+    }
+
+  private:
+    jss::object_ptr<VehicleComponent> vehicle_;
+    float time_ = 0.0f;
+    float phase_ = 0.0f;
+};
+
+static void LoadKartScene(Scene& scene, uint32_t kart_count,
+                          vector<Transform*>& karts)
+{
+    {
+        auto& entity = scene.AddEntity("Track-Main");
+        entity.AddComponent<Transform>();
+
+        auto& static_body = entity.AddComponent<MeshStaticBody>();
+        static_body.SetMesh("track3-collision", 1.0f);
+    }
+
+    std::mt19937 rng(kBenchmarkSeed);
+    std::uniform_real_distribution<float> phase_dist(0.0f, 6.28f);
+
+    for (uint32_t i = 0; i < kart_count; i++)
+    {
+        const std::string name = fmt::format("BenchKart-{}", i);
+        const vec3 grid_pos(static_cast<float>(i % kGridColumns),
+                            0.0f,
+                            static_cast<float>(i / kGridColumns));
+
+        Entity& entity = scene.AddEntity(name);
+
+        auto& transform = entity.AddComponent<Transform>();
+        transform.SetPosition(kGridOrigin + grid_pos * kGridSpacing);
+        transform.RotateEulerDegrees(vec3(0.0f, 180.0f, 0.0f));
+
+        entity.AddComponent<AudioEmitter>();
+
+        auto& vehicle = entity.AddComponent<VehicleComponent>();
+        vehicle.SetVehicleName(name);
+
+        auto& driver = entity.AddComponent<BenchDriver>();
+        driver.SetPhase(phase_dist(rng));
+
+        karts.push_back(&transform);
+    }
+}
+
+static void RunFrameBenchmark(BenchmarkRunner& runner, BenchApp& app,
+                              uint32_t kart_count)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const uint32_t frames = runner.GetOptions().scene_frames;
+    vector<double> samples_ns;
+    samples_ns.reserve(frames);
+
+    for (uint32_t i = 0; i < kWarmupFrames; i++)
+    {
+        app.RunFrame();
+    }
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        const auto start = Clock::now();
+        app.RunFrame();
+        const auto end = Clock::now();
+
+        samples_ns.push_back(
+            std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    runner.AddResult(fmt::format("Scene::Frame/{} karts", kart_count),
+                     std::move(samples_ns));
+}
+
+static void RunRaycastBenchmark(BenchmarkRunner& runner, BenchApp& app,
+                                const vector<Transform*>& karts)
+{
+    PhysicsService& physics_service =
+        app.GetServiceProvider().GetService<PhysicsService>();
+
+    std::mt19937 rng(kBenchmarkSeed);
+    std::uniform_int_distribution<size_t> kart_dist(0, karts.size() - 1);
+    std::uniform_real_distribution<float> offset_dist(-5.0f, 5.0f);
+
+    // Cast down onto a random kart, sometimes missing it
+    runner.Run(
+        fmt::format("PhysicsService::RaycastDynamic/{} karts", karts.size()),
+        200, 100,
+        [&]()
+        {
+            const vec3 target = karts[kart_dist(rng)]->GetPosition();
+            const vec3 origin =
+                target + vec3(offset_dist(rng), 50.0f, offset_dist(rng));
+
+            DoNotOptimize(physics_service.RaycastDynamic(
+                origin, vec3(0.0f, -1.0f, 0.0f), 100.0f));
+        });
+}
+
+// Compares restarting from a snapshot against loading the scene again
+static void RunRestartBenchmark(BenchmarkRunner& runner, BenchApp& app,
+                                uint32_t kart_count)
+{
+    using Clock = std::chrono::steady_clock;
+
+    SceneSnapshotService& snapshot_service =
+        app.GetServiceProvider().GetService<SceneSnapshotService>();
+    const std::string scene_name = fmt::format("Bench-Karts-{}", kart_count);
+
+    vector<Transform*> karts;
+    vector<double> restore_ns;
+    vector<double> reload_ns;
+
+    // Captures on the next frame, after the loader has run
+    snapshot_service.RequestCapture();
+    app.RunFrame();
+
+    const uint32_t reloads_before = snapshot_service.GetReloadCount();
+
+    for (uint32_t i = 0; i < kRestartSamples; i++)
+    {
+        for (uint32_t frame = 0; frame < kWarmupFrames; frame++)
+        {
+            app.RunFrame();
+        }
+
+        const auto start = Clock::now();
+        snapshot_service.RequestRestore();
+        app.RunFrame();
+        const auto end = Clock::now();
+
+        restore_ns.push_back(
+            std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    // Those samples timed a scene change request, not a restore
+    const uint32_t reloads =
+        snapshot_service.GetReloadCount() - reloads_before;
+
+    if (reloads > 0)
+    {
+        debug::LogWarn("Scene::Restore/{} karts reloaded the scene {} of {} "
+                       "times, those samples are not restores",
+                       kart_count, reloads, kRestartSamples);
+    }
+
+    for (uint32_t i = 0; i < kRestartSamples; i++)
+    {
+        karts.clear();
+
+        const auto start = Clock::now();
+        app.LoadScene(scene_name,
+                      [&](Scene& scene)
+                      { LoadKartScene(scene, kart_count, karts); });
+        const auto end = Clock::now();
+
+        reload_ns.push_back(
+            std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    runner.AddResult(fmt::format("Scene::Restore/{} karts", kart_count),
+                     std::move(restore_ns));
+    runner.AddResult(fmt::format("Scene::Reload/{} karts", kart_count),
+                     std::move(reload_ns));
+}
+
+void RunSceneBenchmarks(BenchmarkRunner& runner, BenchApp& app)
+{
+    app.GetServiceProvider()
+        .GetService<ComponentUpdateService>()
+        .RegisterSystem<BenchDriver>(SystemStage::kInput);
+
+    for (uint32_t kart_count : kKartCounts)
+    {
+        const std::string frame_name =
+            fmt::format("Scene::Frame/{} karts", kart_count);
+        const std::string raycast_name = fmt::format(
+            "PhysicsService::RaycastDynamic/{} karts", kart_count);
+        const std::string restore_name =
+            fmt::format("Scene::Restore/{} karts", kart_count);
+
+        if (!runner.ShouldRun(frame_name) && !runner.ShouldRun(raycast_name) &&
+            !runner.ShouldRun(restore_name))
+        {
+            continue;
+        }
+
+        vector<Transform*> karts;
+        app.LoadScene(fmt::format("Bench-Karts-{}", kart_count),
+                      [&](Scene& scene)
+                      { LoadKartScene(scene, kart_count, karts); });
+
+        if (runner.ShouldRun(frame_name))
+        {
+            RunFrameBenchmark(runner, app, kart_count);
+        }
+
+        RunRaycastBenchmark(runner, app, karts);
+
+        // Reloads the scene, so it runs last
+        if (runner.ShouldRun(restore_name))
+        {
+            RunRestartBenchmark(runner, app, kart_count);
+        }
+    }
+}
@@ -51,7 +51,7 @@ void AIService::OnStart(ServiceProvider& service_provider)
 {
 }
 
-void AIService::OnUpdate()
+void AIService::OnUpdate(const FrameContext& frame)
 {
 }
 
@@ -64,6 +64,16 @@ std::string_view AIService::GetName() const
     return "AI Service";
 }
 
+ServiceAccess AIService::GetAccess() const
+{
+    // Nothing to update, AIController makes its decisions from OnUpdateEvent
+    // inside ComponentUpdateService, on the main thread
+    return ServiceAccess{.reads = service_access::kNone,
+                         .writes = service_access::kNone,
+                         .main_thread = false,
+                         .phase = UpdatePhase::kSimulation};
+}
+
 void AIService::ReadVertices()
 {
     std::fstream file;
@@ -22,9 +22,10 @@ class AIService final : public Service
     // From Service
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
     void ReadVertices();
 
     std::vector<glm::vec3> GetPath();
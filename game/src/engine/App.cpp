@@ -1,43 +1,73 @@
 #include "engine/App.h"
 
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/input/InputService.h"
 
 using std::make_unique;
 using std::string;
 using std::string_view;
 
-App::App()
+// Simulated frame time used when there is no window to pace the loop
+static const Timestep kHeadlessTimestep = Timestep::Seconds(1.0 / 60.0);
+
+App::App(const AppOptions& options)
     : running_(false),
+      options_(options),
       window_(),
+      job_system_(),
       service_provider_(),
       scene_list_(),
       event_bus_(),
-      last_frame_(),
-      delta_time_(),
-      requested_scene_(std::nullopt)
+      frame_(),
+      frame_pacer_(),
+      requested_scene_(std::nullopt),
+      preparing_scene_(std::nullopt),
+      loading_scene_(std::nullopt),
+      prepare_counter_(0),
+      prepare_start_frame_(0),
+      simulation_thread_(nullptr)
 {
 }
 
 void App::Run()
 {
     // Setup phase
-    window_.Create(100, 100, "app");
-    window_.SetCallbacks(shared_from_this());
+    if (!options_.headless)
+    {
+        window_.Create(100, 100, "app");
+        window_.SetCallbacks(shared_from_this());
+    }
 
     // Init phase
     OnInit();
     service_provider_.DispatchInit(*this);
 
-    const glm::ivec2 window_size = window_.GetSize();
-    service_provider_.DispatchWindowSizeChanged(window_size.x, window_size.y);
+    if (!options_.headless)
+    {
+        const glm::ivec2 window_size = window_.GetSize();
+        service_provider_.DispatchWindowSizeChanged(window_size.x,
+                                                    window_size.y);
+    }
 
     // Run phase
+    running_ = true;
+    frame_pacer_.SetMaxFps(options_.max_fps);
     service_provider_.DispatchStart();
+
+    if (options_.threaded_simulation && !options_.headless)
+    {
+        simulation_thread_ = make_unique<SimulationThread>(
+            [this](const FrameContext& frame)
+            { service_provider_.DispatchSimulationUpdate(frame); });
+    }
+
     OnStart();
     PerformGameLoop();
 
     // Cleanup phase
+    simulation_thread_.reset();
+    job_system_.Wait(prepare_counter_);
     OnCleanup();
     service_provider_.DispatchCleanup();
 }
@@ -67,12 +97,23 @@ void App::OnSceneUnloaded(Scene& scene)
     // To be overridden
 }
 
+void App::OnScenePrepare(const string& scene_name)
+{
+    // To be overridden
+}
+
 Scene& App::AddScene(const string& name)
 {
     auto scene = make_unique<Scene>(name, service_provider_);
     return scene_list_.AddScene(std::move(scene));
 }
 
+void App::SetLoadingScene(const string& name)
+{
+    ASSERT_MSG(scene_list_.HasScene(name), "Scene must exist");
+    loading_scene_ = name;
+}
+
 ServiceProvider& App::GetServiceProvider()
 {
     return service_provider_;
@@ -85,9 +126,29 @@ void App::SetActiveScene(const string& name)
     requested_scene_ = name;
 }
 
-const Timestep& App::GetDeltaTime() const
+void App::Quit()
 {
-    return delta_time_;
+    running_ = false;
+}
+
+void App::SetMaxFps(double max_fps)
+{
+    frame_pacer_.SetMaxFps(max_fps);
+}
+
+const FrameContext& App::GetFrameContext() const
+{
+    return frame_;
+}
+
+double App::GetMaxFps() const
+{
+    return frame_pacer_.GetMaxFps();
+}
+
+bool App::IsHeadless() const
+{
+    return options_.headless;
 }
 
 SceneList& App::GetSceneList()
@@ -95,6 +156,11 @@ SceneList& App::GetSceneList()
     return scene_list_;
 }
 
+JobSystem& App::GetJobSystem()
+{
+    return job_system_;
+}
+
 Window& App::GetWindow()
 {
     return window_;
@@ -107,38 +173,176 @@ EventBus& App::GetEventBus()
 
 void App::PerformGameLoop()
 {
-    running_ = true;
+    while (running_)
+    {
+        if (!options_.headless && window_.ShouldClose())
+        {
+            break;
+        }
+
+        if (options_.max_frames > 0 && frame_.index >= options_.max_frames)
+        {
+            debug::LogInfo("Reached frame limit: {}", options_.max_frames);
+            break;
+        }
+
+        RunFrame();
+    }
+}
+
+void App::RunFrame()
+{
+    debug::Profiler::BeginFrame();
+    PROFILE_SCOPE("App::Frame");
+
+    // Everything up to starting the next tick needs the simulation to be idle
+    if (simulation_thread_)
+    {
+        PROFILE_SCOPE("App::WaitForSimulation");
+        simulation_thread_->Wait();
+    }
+
+    // Nothing is publishing, so the event counters are settled
+    event_bus_.CaptureStats();
+
+    // Whatever the last tick posted, before its entities can be destroyed
+    FlushEvents();
+
+    // Entities destroyed during the last frame go now, while nothing is
+    // iterating over the scene
+    if (scene_list_.HasActiveScene())
+    {
+        PROFILE_SCOPE("Scene::FlushDestroyedEntities");
+        scene_list_.GetActiveScene().FlushDestroyedEntities();
+    }
 
-    while (running_ && !window_.ShouldClose())
+    // A newer request replaces whatever was still being prepared, but only
+    // once those jobs are done, so the frame never stalls on them
+    if (requested_scene_ &&
+        prepare_counter_.load(std::memory_order_acquire) == 0)
+    {
+        BeginScenePrepare();
+    }
+
+    if (preparing_scene_ && !requested_scene_)
+    {
+        UpdateScenePrepare();
+    }
+
+    CalculateDeltaTime();
+
+    if (!options_.headless)
     {
-        CalculateDeltaTime();
         window_.PollEvents();
+    }
+
+    service_provider_.DispatchFrameUpdate(frame_);
+
+    // So the tick below sees what the frame update posted
+    FlushEvents();
 
-        service_provider_.DispatchUpdate();
+    if (simulation_thread_)
+    {
+        simulation_thread_->Start(frame_);
+    }
+    else
+    {
+        service_provider_.DispatchSimulationUpdate(frame_);
+    }
 
+    // Only reads published snapshots, so it can overlap with the tick
+    service_provider_.DispatchRender();
+
+    if (!options_.headless)
+    {
+        PROFILE_SCOPE("Window::SwapBuffers");
         window_.SwapBuffers();
+    }
 
-        if (requested_scene_)
-        {
-            DispatchSceneChange();
-        }
+    {
+        PROFILE_SCOPE("App::FramePacing");
+        frame_pacer_.Wait();
     }
+
+    frame_.index++;
+}
+
+void App::FlushEvents()
+{
+    // Goes down to the active scene's bus too
+    PROFILE_SCOPE("EventBus::Flush");
+    event_bus_.Flush();
 }
 
 void App::CalculateDeltaTime()
 {
-    const Timestep current_frame = Timestep::Seconds(glfwGetTime());
-    delta_time_ = current_frame - last_frame_;
-    last_frame_ = current_frame;
+    const Timestep wall_delta = frame_pacer_.Tick();
+
+    // Headless time is deterministic, independent of how fast the host runs
+    frame_.delta_time = options_.headless ? kHeadlessTimestep : wall_delta;
+    frame_.elapsed_time += frame_.delta_time;
 }
 
-void App::DispatchSceneChange()
+void App::BeginScenePrepare()
 {
     ASSERT_MSG(requested_scene_.has_value(),
                "Must request a scene change first");
 
+    ASSERT_MSG(prepare_counter_.load(std::memory_order_acquire) == 0,
+               "Must finish the previous scene prepare first");
+
+    const string name = requested_scene_.value();
+    requested_scene_.reset();
+    preparing_scene_ = name;
+    prepare_start_frame_ = frame_.index;
+
+    debug::LogInfo("Preparing scene: {}", name);
+    service_provider_.DispatchScenePrepare(name, prepare_counter_);
+    job_system_.SubmitBackground([this, name]() { OnScenePrepare(name); },
+                                 &prepare_counter_);
+
+    // Nothing to show in the meantime, and headless runs must stay
+    // deterministic, so load in the same frame
+    if (options_.headless)
+    {
+        job_system_.Wait(prepare_counter_);
+    }
+}
+
+void App::UpdateScenePrepare()
+{
+    ASSERT_MSG(preparing_scene_.has_value(), "Must be preparing a scene");
+
+    if (prepare_counter_.load(std::memory_order_acquire) == 0)
+    {
+        // Swapped in while the simulation is idle, so no tick ever sees a
+        // half loaded scene
+        DispatchSceneChange(preparing_scene_.value());
+        preparing_scene_.reset();
+        return;
+    }
+
+    // Quick loads swap straight over on the next frame, anything slower
+    // gets the loading scene until it's done
+    if (frame_.index == prepare_start_frame_)
+    {
+        return;
+    }
+
+    const bool showing_loading_scene =
+        scene_list_.HasActiveScene() &&
+        scene_list_.GetActiveScene().GetName() == loading_scene_;
+
+    if (loading_scene_ && !showing_loading_scene)
+    {
+        DispatchSceneChange(loading_scene_.value());
+    }
+}
+
+void App::DispatchSceneChange(const string& name)
+{
+    PROFILE_SCOPE("App::SceneChange");
     debug::LogInfo("Dispatching scene change...");
-    const std::string& name = requested_scene_.value();
 
     if (scene_list_.HasActiveScene())
     {
@@ -159,7 +363,6 @@ void App::DispatchSceneChange()
     OnSceneLoaded(new_scene);
 
     debug::LogInfo("Active scene set to: {}", name);
-    requested_scene_.reset();
 }
 
 void App::OnKeyEvent(int key, int scancode, int action, int mods)
@@ -1,23 +1,48 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string_view>
 
 #include "engine/core/gfx/Window.h"
+#include "engine/core/jobs/JobSystem.h"
 #include "engine/core/math/Timestep.h"
+#include "engine/core/time/FrameContext.h"
+#include "engine/core/time/FramePacer.h"
+#include "engine/SimulationThread.h"
 #include "engine/scene/Scene.h"
 #include "engine/scene/SceneList.h"
 #include "engine/service/ServiceProvider.h"
 
+struct AppOptions
+{
+    // Run without a window or GL context, stepping time at a fixed rate
+    bool headless = false;
+
+    // Stop after this many frames, 0 runs until quit
+    uint64_t max_frames = 0;
+
+    /**
+     * Simulate on a dedicated thread while the main thread renders the last
+     * tick. Ignored when headless, since there is nothing to overlap with
+     */
+    bool threaded_simulation = true;
+
+    // Sleeps off the rest of each frame above this rate, 0 is uncapped
+    double max_fps = 0.0;
+};
+
 class App : public std::enable_shared_from_this<App>,
             public IWindowEventListener
 {
   public:
-    App();
+    App(const AppOptions& options = {});
 
     void Run();
+    void Quit();
     void SetActiveScene(const std::string& name);
+    void SetMaxFps(double max_fps);
 
     // From IWindowEventListener
     void OnKeyEvent(int key, int scancode, int action, int mods) override;
@@ -27,10 +52,13 @@ class App : public std::enable_shared_from_this<App>,
     void OnWindowSizeChanged(int width, int height) override;
     void OnJoystickChangedEvent(int joystick_id, int event) override;
 
-    const Timestep& GetDeltaTime() const;
+    const FrameContext& GetFrameContext() const;
+    double GetMaxFps() const;
+    bool IsHeadless() const;
     Window& GetWindow();
     EventBus& GetEventBus();
     SceneList& GetSceneList();
+    JobSystem& GetJobSystem();
 
   protected:
     virtual void OnInit();
@@ -39,6 +67,9 @@ class App : public std::enable_shared_from_this<App>,
     virtual void OnSceneLoaded(Scene& scene);
     virtual void OnSceneUnloaded(Scene& scene);
 
+    // Runs on a worker thread next to every service's OnScenePrepare
+    virtual void OnScenePrepare(const std::string& scene_name);
+
     template <class ServiceType>
         requires std::derived_from<ServiceType, Service>
     void AddService()
@@ -47,18 +78,35 @@ class App : public std::enable_shared_from_this<App>,
     }
 
     Scene& AddScene(const std::string& name);
+
+    // Scene shown while another one is being prepared in the background
+    void SetLoadingScene(const std::string& name);
     ServiceProvider& GetServiceProvider();
 
+    // Runs a single iteration of the game loop
+    void RunFrame();
+
   private:
     bool running_;
+    AppOptions options_;
     Window window_;
+    JobSystem job_system_;
     ServiceProvider service_provider_;
     SceneList scene_list_;
     EventBus event_bus_;
-    Timestep last_frame_, delta_time_;
+    FrameContext frame_;
+    FramePacer frame_pacer_;
     std::optional<std::string> requested_scene_;
+    std::optional<std::string> preparing_scene_;
+    std::optional<std::string> loading_scene_;
+    JobCounter prepare_counter_;
+    uint64_t prepare_start_frame_;
+    std::unique_ptr<SimulationThread> simulation_thread_;
 
     void PerformGameLoop();
     void CalculateDeltaTime();
-    void DispatchSceneChange();
+    void FlushEvents();
+    void BeginScenePrepare();
+    void UpdateScenePrepare();
+    void DispatchSceneChange(const std::string& name);
 };
\ No newline at end of file
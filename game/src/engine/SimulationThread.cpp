@@ -0,0 +1,74 @@
+#include "engine/SimulationThread.h"
+
+#include "engine/core/debug/Assert.h"
+#include "engine/core/debug/Profiler.h"
+
+SimulationThread::SimulationThread(Tick tick)
+    : tick_(std::move(tick)),
+      frame_{},
+      mutex_{},
+      cv_{},
+      tick_pending_(false),
+      stopping_(false),
+      thread_()
+{
+    // Started last so the loop never sees half initialized members
+    thread_ = std::thread(&SimulationThread::ThreadLoop, this);
+}
+
+SimulationThread::~SimulationThread()
+{
+    Wait();
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+
+    cv_.notify_all();
+    thread_.join();
+}
+
+void SimulationThread::Start(const FrameContext& frame)
+{
+    {
+        std::lock_guard lock(mutex_);
+        ASSERT_MSG(!tick_pending_, "Must wait for the last tick first");
+        frame_ = frame;
+        tick_pending_ = true;
+    }
+
+    cv_.notify_all();
+}
+
+void SimulationThread::Wait()
+{
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this]() { return !tick_pending_; });
+}
+
+void SimulationThread::ThreadLoop()
+{
+    std::unique_lock lock(mutex_);
+
+    while (true)
+    {
+        cv_.wait(lock, [this]() { return tick_pending_ || stopping_; });
+
+        if (stopping_)
+        {
+            return;
+        }
+
+        lock.unlock();
+
+        {
+            PROFILE_SCOPE("SimulationThread::Tick");
+            tick_(frame_);
+        }
+
+        lock.lock();
+        tick_pending_ = false;
+        cv_.notify_all();
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "engine/core/time/FrameContext.h"
+
+/**
+ * Dedicated thread that runs one simulation tick at a time. The main thread
+ * starts a tick, renders the previous one, and waits for the tick to finish
+ * before touching the scene again.
+ *
+ * Each tick gets its own copy of the frame clock, since the main thread moves
+ * on to the next frame while the tick is still running
+ */
+class SimulationThread
+{
+  public:
+    using Tick = std::function<void(const FrameContext& frame)>;
+
+    SimulationThread(Tick tick);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    void Start(const FrameContext& frame);
+
+    // Blocks until the running tick is done, returns immediately when idle
+    void Wait();
+
+  private:
+    Tick tick_;
+
+    // Written by Start while idle, only read by the thread during the tick
+    FrameContext frame_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool tick_pending_;
+    bool stopping_;
+    std::thread thread_;
+
+    void ThreadLoop();
+};
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <fstream>
 
+#include "engine/App.h"
 #include "engine/asset/AssetBundle.h"
 #include "engine/core/debug/Log.h"
 #include "engine/core/gfx/Cubemap.h"
@@ -170,7 +171,7 @@ void AssetService::OnStart(ServiceProvider &service_provider)
     GetEventBus().Subscribe<OnGuiEvent>(this);
 }
 
-void AssetService::OnUpdate()
+void AssetService::OnUpdate(const FrameContext& frame)
 {
     if (input_service_->IsKeyPressed(GLFW_KEY_F5))
     {
@@ -221,6 +222,13 @@ string_view AssetService::GetName() const
     return "AssetService";
 }
 
+ServiceAccess AssetService::GetAccess() const
+{
+    return ServiceAccess{.reads = service_access::kInput,
+                         .writes = service_access::kNone,
+                         .main_thread = false};
+}
+
 void AssetService::LoadAssetFile(const string &path)
 {
     std::ifstream file_stream(path);
@@ -240,6 +248,12 @@ void AssetService::LoadAssetFile(const string &path)
         LoadMesh(mesh.path, mesh.name);
     }
 
+    // Textures and cubemaps need a GL context, so skip them when headless
+    if (GetApp().IsHeadless())
+    {
+        return;
+    }
+
     for (auto &texture : bundle.textures)
     {
         LoadTexture(texture.path, texture.name);
@@ -32,9 +32,10 @@ class AssetService final : public Service, public IEventSubscriber<OnGuiEvent>
     // From Service
     void OnInit() override;
     void OnStart(ServiceProvider &service_provider) override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     // From IEventSubscriber<OnGuiEvent>
     void OnGui() override;
@@ -4,6 +4,7 @@
 
 #include "engine/core/debug/Log.h"
 #include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
 #include "engine/scene/Transform.h"
 #include "engine/service/ServiceProvider.h"
 #include "stb/stb_vorbis.h"
@@ -22,6 +23,9 @@ static const std::string kMusicDirectory = "resources/audio/music/";
 static constexpr std::size_t kStreamBufferAmount = 4;
 static constexpr ALsizei kStreamBufferSize = 65536;  // 32kb per buffer
 
+// distance until a source is silent
+static constexpr float kMaxSourceDistance = 500.0f;
+
 /* ----- setting sources ----- */
 
 void AudioService::AddSource(std::string file_name)
@@ -103,8 +107,8 @@ void AudioService::AddSource(uint32_t entity_id, std::string file_name)
     alSourcei(source, AL_BUFFER, buffer);
 
     // spatial properties
-    alSourcef(source, AL_MAX_DISTANCE, 500.0f);        // distance until silent
-    alSourcef(source, AL_REFERENCE_DISTANCE, 150.0f);  // ... until gain halfed
+    alSourcef(source, AL_MAX_DISTANCE, kMaxSourceDistance);
+    alSourcef(source, AL_REFERENCE_DISTANCE, 150.0f);  // until gain halfed
     alSourcef(source, AL_ROLLOFF_FACTOR, 0.6f);        // rolloff rate
 
     SourceBufferPair source_buffer_pair = {source, buffer};
@@ -434,6 +438,11 @@ void AudioService::SetLoop(uint32_t entity_id, std::string file_name,
 
 void AudioService::SetSourcePosition(uint32_t entity_id, glm::vec3 position)
 {
+    if (cull_sources_ && !audible_entities_.contains(entity_id))
+    {
+        return;
+    }
+
     for (auto& source : diegetic_sources_[entity_id])
     {
         std::string file_name = source.first;
@@ -468,16 +477,28 @@ void AudioService::SetListener(Entity& listener)
 
 void AudioService::UpdateListener()
 {
-    if (!listener_ || !listener_->HasComponent<Transform>())
+    Transform* listener_transform =
+        listener_ ? listener_->TryGetComponent<Transform>() : nullptr;
+
+    if (!listener_transform)
     {
         // leave listener properties as default (probably at origin)
+        cull_sources_ = false;
         return;
     }
 
-    auto& transform = listener_->GetComponent<Transform>();
+    auto& transform = *listener_transform;
 
     glm::vec3 position = transform.GetPosition();
 
+    // past the max distance sources stop falling off, so the ones out there
+    // just keep the last position they had in earshot
+    audible_entities_.clear();
+    listener_->GetScene().GetSpatialIndex().ForEachInRadius(
+        position, kMaxSourceDistance,
+        [this](Entity& entity) { audible_entities_.insert(entity.GetId()); });
+    cull_sources_ = true;
+
     glm::vec3 forward = transform.GetForwardDirection();
     glm::vec3 up = transform.GetUpDirection();
 
@@ -802,7 +823,7 @@ void AudioService::OnSceneLoaded(Scene& scene)
 {
 }
 
-void AudioService::OnUpdate()
+void AudioService::OnUpdate(const FrameContext& frame)
 {
     // check if there's something to update
     if (music_source_.second.first != NULL)
@@ -854,3 +875,12 @@ std::string_view AudioService::GetName() const
 {
     return "AudioService";
 }
+
+ServiceAccess AudioService::GetAccess() const
+{
+    // OpenAL contexts are shared between threads, so streaming can run anywhere
+    return ServiceAccess{.reads = service_access::kScene,
+                         .writes = service_access::kAudio,
+                         .main_thread = false,
+                         .phase = UpdatePhase::kSimulation};
+}
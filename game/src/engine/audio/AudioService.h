@@ -4,6 +4,7 @@
 
 #include <glm/glm.hpp>
 #include <map>
+#include <unordered_set>
 
 #include "AudioFile.h"
 #include "engine/fwd/FwdServices.h"
@@ -164,6 +165,8 @@ class AudioService final : public Service
      *
      *  @param entity_id the sources associated entity id.
      *  @param position the position to set the source at.
+     *
+     *  @note skipped for entities out of the listener's earshot.
      */
     void SetSourcePosition(uint32_t entity_id, glm::vec3 position);
 
@@ -174,9 +177,10 @@ class AudioService final : public Service
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
     void OnSceneLoaded(Scene& scene) override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
   private:
     /* ----- on update ----- */
@@ -249,7 +253,12 @@ class AudioService final : public Service
     ALCdevice* audio_device_;    // the sound device to output audio to.
     ALCcontext* audio_context_;  // like an openGL context.
 
-    Entity* listener_;  // the entity that can "hear" all positional audio
+    Entity* listener_ = nullptr;  // the entity that can "hear" positional audio
+
+    /// entities within earshot of the listener, as of the last update.
+    std::unordered_set<EntityID> audible_entities_;
+    /// false without a listener, every source is positioned then.
+    bool cull_sources_ = false;
 
     /// all audio files for sfx
     std::map<FileName, AudioFile> sfx_files_;
@@ -0,0 +1,282 @@
+#include "engine/core/debug/Profiler.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+using std::string;
+using std::string_view;
+using std::unique_ptr;
+using std::vector;
+
+namespace debug
+{
+
+// Buffers are only ever added, so zones from finished threads stay readable
+static std::mutex kBuffersMutex;
+static vector<unique_ptr<ProfileZoneBuffer>> kBuffers;
+static thread_local ProfileZoneBuffer* kThreadBuffer = nullptr;
+
+static constexpr size_t kCounterCapacity = 1 << 12;
+static std::mutex kCountersMutex;
+static std::deque<ProfileCounter> kCounters;
+
+static std::atomic<bool> kEnabled = true;
+static ProfileFrame kCurrentFrame{};
+static ProfileFrame kLastFrame{};
+
+static string EscapeJson(string_view text)
+{
+    string escaped;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+
+    return escaped;
+}
+
+/* ----- ProfileZoneBuffer ----- */
+
+ProfileZoneBuffer::ProfileZoneBuffer(uint32_t thread_id)
+    : zones_{},
+      write_index_(0),
+      mutex_{},
+      thread_id_(thread_id),
+      depth_(0)
+{
+}
+
+void ProfileZoneBuffer::Push(const ProfileZone& zone)
+{
+    std::lock_guard lock(mutex_);
+    zones_[write_index_ % kCapacity] = zone;
+    write_index_++;
+}
+
+void ProfileZoneBuffer::CopyZones(uint64_t since_ns,
+                                  vector<ProfileZone>& out) const
+{
+    {
+        std::lock_guard lock(mutex_);
+        const uint64_t begin =
+            write_index_ > kCapacity ? write_index_ - kCapacity : 0;
+
+        for (uint64_t i = begin; i < write_index_; i++)
+        {
+            out.push_back(zones_[i % kCapacity]);
+        }
+    }
+
+    std::erase_if(out, [since_ns](const ProfileZone& zone)
+                  { return zone.end_ns < since_ns; });
+}
+
+uint32_t ProfileZoneBuffer::GetThreadId() const
+{
+    return thread_id_;
+}
+
+uint32_t& ProfileZoneBuffer::GetDepth()
+{
+    return depth_;
+}
+
+/* ----- Profiler ----- */
+
+uint64_t Profiler::Now()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void Profiler::SetEnabled(bool enabled)
+{
+    kEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled()
+{
+    return kEnabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::BeginFrame()
+{
+    const uint64_t now = Now();
+
+    if (kCurrentFrame.start_ns != 0)
+    {
+        kLastFrame = kCurrentFrame;
+        kLastFrame.end_ns = now;
+    }
+
+    kCurrentFrame.index++;
+    kCurrentFrame.start_ns = now;
+}
+
+const ProfileFrame& Profiler::GetLastFrame()
+{
+    return kLastFrame;
+}
+
+ProfileZoneBuffer& Profiler::GetThreadBuffer()
+{
+    if (!kThreadBuffer)
+    {
+        std::lock_guard lock(kBuffersMutex);
+        const uint32_t thread_id = static_cast<uint32_t>(kBuffers.size());
+        kBuffers.push_back(std::make_unique<ProfileZoneBuffer>(thread_id));
+        kThreadBuffer = kBuffers.back().get();
+    }
+
+    return *kThreadBuffer;
+}
+
+vector<ProfileZone> Profiler::CollectZones(uint64_t since_ns)
+{
+    vector<ProfileZone> zones;
+    std::lock_guard lock(kBuffersMutex);
+
+    for (auto& buffer : kBuffers)
+    {
+        buffer->CopyZones(since_ns, zones);
+    }
+
+    return zones;
+}
+
+void Profiler::RecordCounter(string_view name, double value)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard lock(kCountersMutex);
+
+    if (kCounters.size() == kCounterCapacity)
+    {
+        kCounters.pop_front();
+    }
+
+    kCounters.push_back(
+        ProfileCounter{.name = name, .value = value, .time_ns = Now()});
+}
+
+vector<ProfileCounter> Profiler::GetLatestCounters()
+{
+    vector<ProfileCounter> latest;
+    std::lock_guard lock(kCountersMutex);
+
+    for (auto& counter : kCounters)
+    {
+        auto iter = std::find_if(latest.begin(), latest.end(),
+                                 [&counter](const ProfileCounter& x)
+                                 { return x.name == counter.name; });
+
+        if (iter == latest.end())
+        {
+            latest.push_back(counter);
+        }
+        else
+        {
+            *iter = counter;
+        }
+    }
+
+    return latest;
+}
+
+bool Profiler::WriteChromeTrace(const string& path)
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    const vector<ProfileZone> zones = CollectZones(0);
+    vector<ProfileCounter> counters;
+
+    {
+        std::lock_guard lock(kCountersMutex);
+        counters.assign(kCounters.begin(), kCounters.end());
+    }
+
+    // Trace timestamps are in microseconds
+    vector<string> events;
+
+    for (auto& zone : zones)
+    {
+        events.push_back(fmt::format(
+            "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},"
+            "\"ts\":{:.3f},\"dur\":{:.3f}}}",
+            EscapeJson(zone.name), zone.thread_id,
+            static_cast<double>(zone.start_ns) / 1000.0,
+            static_cast<double>(zone.end_ns - zone.start_ns) / 1000.0));
+    }
+
+    for (auto& counter : counters)
+    {
+        events.push_back(fmt::format(
+            "{{\"name\":\"{}\",\"ph\":\"C\",\"pid\":0,\"ts\":{:.3f},"
+            "\"args\":{{\"value\":{}}}}}",
+            EscapeJson(counter.name),
+            static_cast<double>(counter.time_ns) / 1000.0, counter.value));
+    }
+
+    file << "{\"traceEvents\":[\n";
+
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        file << events[i] << (i + 1 < events.size() ? ",\n" : "\n");
+    }
+
+    file << "]}\n";
+    return true;
+}
+
+/* ----- ScopedZone ----- */
+
+ScopedZone::ScopedZone(string_view name)
+    : name_(name),
+      start_ns_(0),
+      active_(Profiler::IsEnabled())
+{
+    if (active_)
+    {
+        Profiler::GetThreadBuffer().GetDepth()++;
+        start_ns_ = Profiler::Now();
+    }
+}
+
+ScopedZone::~ScopedZone()
+{
+    if (!active_)
+    {
+        return;
+    }
+
+    const uint64_t end_ns = Profiler::Now();
+    ProfileZoneBuffer& buffer = Profiler::GetThreadBuffer();
+    uint32_t& depth = buffer.GetDepth();
+    depth--;
+
+    buffer.Push(ProfileZone{.name = name_,
+                            .start_ns = start_ns_,
+                            .end_ns = end_ns,
+                            .depth = depth,
+                            .thread_id = buffer.GetThreadId()});
+}
+
+}  // namespace debug
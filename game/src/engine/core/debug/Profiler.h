@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+// Times the enclosing scope. The name must outlive the profiler (use literals)
+#define PROFILE_SCOPE(name) \
+    debug::ScopedZone PROFILE_CONCAT(profile_zone_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+
+// Records a sample of a named value. The name must outlive the profiler
+#define PROFILE_COUNTER(name, value) \
+    debug::Profiler::RecordCounter(name, static_cast<double>(value))
+
+namespace debug
+{
+
+struct ProfileZone
+{
+    std::string_view name;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint32_t depth;
+    uint32_t thread_id;
+};
+
+struct ProfileCounter
+{
+    std::string_view name;
+    double value;
+    uint64_t time_ns;
+};
+
+struct ProfileFrame
+{
+    uint64_t index;
+    uint64_t start_ns;
+    uint64_t end_ns;
+};
+
+/**
+ * Fixed size ring of completed zones, written only by the thread that owns it.
+ * Both sides take the buffer's own lock, which nobody else contends for
+ * unless a reader is copying zones out.
+ */
+class ProfileZoneBuffer
+{
+  public:
+    static constexpr size_t kCapacity = 1 << 14;
+
+    ProfileZoneBuffer(uint32_t thread_id);
+
+    void Push(const ProfileZone& zone);
+    void CopyZones(uint64_t since_ns, std::vector<ProfileZone>& out) const;
+
+    uint32_t GetThreadId() const;
+    uint32_t& GetDepth();
+
+  private:
+    std::array<ProfileZone, kCapacity> zones_;
+    uint64_t write_index_;
+    mutable std::mutex mutex_;
+    uint32_t thread_id_;
+    uint32_t depth_;
+};
+
+class Profiler
+{
+  public:
+    static uint64_t Now();
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    /**
+     * Marks the start of a new frame on the main thread. The frame before it
+     * becomes the "last frame" shown by the profiler GUI
+     */
+    static void BeginFrame();
+    static const ProfileFrame& GetLastFrame();
+
+    static ProfileZoneBuffer& GetThreadBuffer();
+
+    // Collects zones from every thread that ended after the given time
+    static std::vector<ProfileZone> CollectZones(uint64_t since_ns);
+
+    // Counters are sampled a few times per frame at most, so they share one
+    // locked buffer instead of a ring per thread
+    static void RecordCounter(std::string_view name, double value);
+
+    // Most recent sample of every counter, in the order first recorded
+    static std::vector<ProfileCounter> GetLatestCounters();
+
+    // Writes everything still in the ring buffers as Chrome about:tracing JSON
+    static bool WriteChromeTrace(const std::string& path);
+};
+
+class ScopedZone
+{
+  public:
+    ScopedZone(std::string_view name);
+    ~ScopedZone();
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+  private:
+    std::string_view name_;
+    uint64_t start_ns_;
+    bool active_;
+};
+
+}  // namespace debug
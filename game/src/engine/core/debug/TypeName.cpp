@@ -0,0 +1,69 @@
+#include "engine/core/debug/TypeName.h"
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+
+#if !defined(_MSC_VER)
+#include <cxxabi.h>
+
+#include <cstdlib>
+#endif
+
+using std::string;
+using std::string_view;
+
+namespace debug
+{
+
+// Map nodes never move, so the names handed out stay valid
+static std::mutex kTypeNamesMutex;
+static std::unordered_map<std::type_index, string> kTypeNames;
+
+static string Demangle(const char* name)
+{
+#if defined(_MSC_VER)
+    // Already readable, apart from the keyword in front
+    string_view result = name;
+
+    for (string_view prefix : {"class ", "struct "})
+    {
+        if (result.starts_with(prefix))
+        {
+            result.remove_prefix(prefix.size());
+            break;
+        }
+    }
+
+    return string(result);
+#else
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+    if (status != 0 || !demangled)
+    {
+        return name;
+    }
+
+    string result = demangled;
+    std::free(demangled);
+    return result;
+#endif
+}
+
+const char* GetTypeName(const std::type_info& type)
+{
+    std::lock_guard lock(kTypeNamesMutex);
+    auto [iter, inserted] = kTypeNames.try_emplace(std::type_index(type));
+
+    if (inserted)
+    {
+        iter->second = Demangle(type.name());
+    }
+
+    return iter->second.c_str();
+}
+
+}  // namespace debug
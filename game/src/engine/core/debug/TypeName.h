@@ -0,0 +1,21 @@
+#pragma once
+
+#include <typeinfo>
+
+namespace debug
+{
+
+/**
+ * Readable name of a type for debug views and profiler zones, since GCC and
+ * Clang only give out mangled names. The name lives until the program exits
+ */
+const char* GetTypeName(const std::type_info& type);
+
+template <class Type>
+const char* GetTypeName()
+{
+    static const char* const name = GetTypeName(typeid(Type));
+    return name;
+}
+
+}  // namespace debug
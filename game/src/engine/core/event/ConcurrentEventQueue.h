@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "engine/core/event/EventBus.h"
+
+// Events pushed from other threads, delivered by an EventBus it's added to
+class IEventSource
+{
+  public:
+    virtual ~IEventSource() = default;
+
+    // Only ever called by the thread flushing the bus
+    virtual void Deliver(EventBus& bus) = 0;
+    virtual void Clear() = 0;
+};
+
+/**
+ * Fixed size ring that any number of threads can push events to without
+ * locking, for callbacks like PhysX's that fire on worker threads and can't
+ * touch the scene. Its bus publishes everything pushed so far on Flush.
+ *
+ * A full queue drops the event instead of blocking or allocating, which is
+ * counted, so size the capacity for a busy tick
+ */
+template <class EventType>
+class ConcurrentEventQueue final : public IEventSource
+{
+  public:
+    // Rounded up to a power of two
+    explicit ConcurrentEventQueue(size_t capacity)
+        : cells_(nullptr),
+          mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+          tail_(0),
+          head_(0),
+          overflow_count_(0),
+          peak_batch_size_(0),
+          delivering_{}
+    {
+        cells_ = std::make_unique<Cell[]>(mask_ + 1);
+
+        // A cell is free to write at position i once its sequence reaches i
+        for (size_t i = 0; i <= mask_; i++)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        delivering_.reserve(mask_ + 1);
+    }
+
+    // Safe from any thread. Returns false if the queue was full
+    bool Push(const EventType& event)
+    {
+        size_t position = tail_.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            Cell& cell = cells_[position & mask_];
+            const size_t sequence =
+                cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) -
+                                  static_cast<intptr_t>(position);
+
+            if (diff == 0)
+            {
+                // Claims the cell, otherwise another producer got it first
+                if (tail_.compare_exchange_weak(position, position + 1,
+                                                std::memory_order_relaxed))
+                {
+                    cell.event = event;
+                    cell.sequence.store(position + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Still holds an event from a lap ago that wasn't delivered
+                overflow_count_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Publishes what's been pushed as one batch. Anything pushed meanwhile
+     * may make it in, at most a full queue's worth is taken per call
+     */
+    void Deliver(EventBus& bus) override
+    {
+        Drain();
+
+        if (delivering_.empty())
+        {
+            return;
+        }
+
+        peak_batch_size_ = std::max(peak_batch_size_, delivering_.size());
+        bus.PublishBatch<EventType>(delivering_);
+        delivering_.clear();
+    }
+
+    void Clear() override
+    {
+        Drain();
+        delivering_.clear();
+    }
+
+    // Approximate while other threads are pushing
+    size_t GetDepth() const
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    // Most events delivered by a single flush, not the ring's high-water mark
+    size_t GetPeakBatchSize() const
+    {
+        return peak_batch_size_;
+    }
+
+    uint64_t GetOverflowCount() const
+    {
+        return overflow_count_.load(std::memory_order_relaxed);
+    }
+
+    size_t GetCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        EventType event;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+
+    // Producers contend on the tail, so it gets a cache line to itself
+    alignas(64) std::atomic<size_t> tail_;
+    alignas(64) std::atomic<size_t> head_;
+    std::atomic<uint64_t> overflow_count_;
+    size_t peak_batch_size_;
+    std::vector<EventType> delivering_;
+
+    // Single consumer, so only the producers race on the cells
+    void Drain()
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+
+        for (size_t taken = 0; taken <= mask_; taken++)
+        {
+            Cell& cell = cells_[head & mask_];
+
+            if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+            {
+                break;
+            }
+
+            delivering_.push_back(std::move(cell.event));
+
+            // Free again once the producers come around the next lap
+            cell.sequence.store(head + mask_ + 1, std::memory_order_release);
+            head++;
+        }
+
+        head_.store(head, std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,24 @@
+#include "engine/core/event/Event.h"
+
+#include <atomic>
+#include <cstdlib>
+
+#include "engine/core/debug/Log.h"
+
+static std::atomic<EventTypeId> kNextEventTypeId = 0;
+
+EventTypeId NextEventTypeId()
+{
+    const EventTypeId id =
+        kNextEventTypeId.fetch_add(1, std::memory_order_relaxed);
+
+    // Buses index a fixed size table with the id, in release builds too
+    if (id >= kMaxEventTypes)
+    {
+        debug::LogError("More than {} event types, raise kMaxEventTypes",
+                        kMaxEventTypes);
+        std::abort();
+    }
+
+    return id;
+}
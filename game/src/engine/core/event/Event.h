@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 struct IEvent
 {
 };
@@ -7,4 +10,23 @@ struct IEvent
 template <class EventType>
 class IEventSubscriber
 {
-};
\ No newline at end of file
+};
+
+using EventTypeId = uint32_t;
+
+// Upper bound on distinct event types, sizes each EventBus's channel table
+static constexpr size_t kMaxEventTypes = 64;
+
+// Hands out ids in order of first use, so they stay dense
+EventTypeId NextEventTypeId();
+
+/**
+ * Dense id for an event type, assigned the first time the type is used, so
+ * an EventBus can index its channels directly instead of hashing a type_index
+ */
+template <class EventType>
+EventTypeId GetEventTypeId()
+{
+    static const EventTypeId id = NextEventTypeId();
+    return id;
+}
@@ -0,0 +1,349 @@
+#include "engine/core/event/EventBus.h"
+
+#include <algorithm>
+
+#include "engine/core/debug/Assert.h"
+#include "engine/core/event/ConcurrentEventQueue.h"
+
+using std::vector;
+
+EventBus::EventBus()
+    : channels_{},
+      queues_{},
+      posted_queues_{},
+      flushing_queues_{},
+      queue_mutex_{},
+      sources_{},
+      stats_enabled_(false),
+      stats_reset_requested_(false),
+      stats_{},
+      downstream_(nullptr)
+{
+}
+
+void EventBus::Flush()
+{
+    // Before the posted queues are swapped, so whatever their handlers post
+    // still goes out with this flush
+    for (IEventSource* source : sources_)
+    {
+        source->Deliver(*this);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        std::swap(posted_queues_, flushing_queues_);
+
+        for (IEventQueue* queue : flushing_queues_)
+        {
+            queue->Swap();
+        }
+    }
+
+    for (IEventQueue* queue : flushing_queues_)
+    {
+        queue->Deliver(*this);
+    }
+
+    flushing_queues_.clear();
+
+    if (downstream_)
+    {
+        downstream_->Flush();
+    }
+}
+
+void EventBus::AddSource(IEventSource* source)
+{
+    ASSERT_MSG(std::find(sources_.begin(), sources_.end(), source) ==
+                   sources_.end(),
+               "Event source was already added");
+    sources_.push_back(source);
+}
+
+void EventBus::RemoveSource(IEventSource* source)
+{
+    std::erase(sources_, source);
+}
+
+void EventBus::Unsubscribe(SubscriptionId id)
+{
+    if (id.type >= channels_.size() || !channels_[id.type])
+    {
+        return;
+    }
+
+    Channel& channel = *channels_[id.type];
+
+    if (id.slot >= channel.slots.size())
+    {
+        return;
+    }
+
+    Slot& slot = channel.slots[id.slot];
+
+    // Already unsubscribed, or cleared along with the rest of the scene
+    if (slot.generation != id.generation)
+    {
+        return;
+    }
+
+    slot.generation++;
+
+    // Moving subscribers around now would skip or repeat one of them, so it's
+    // only marked, and the slot is freed once it's really gone
+    if (channel.publish_depth > 0)
+    {
+        channel.subscribers[slot.index].instance = nullptr;
+        channel.has_removed = true;
+        return;
+    }
+
+    RemoveSubscriber(channel, slot.index);
+}
+
+void EventBus::ClearSubscribers()
+{
+    // Channels keep their capacity for the next scene's subscribers
+    for (auto& channel : channels_)
+    {
+        if (!channel)
+        {
+            continue;
+        }
+
+        ASSERT_MSG(channel->publish_depth == 0,
+                   "Cannot clear subscribers while publishing");
+
+        // Every handle that's still out there goes stale
+        for (const Subscriber& subscriber : channel->subscribers)
+        {
+            channel->slots[subscriber.slot].generation++;
+            channel->free_slots.push_back(subscriber.slot);
+        }
+
+        channel->subscribers.clear();
+        channel->has_removed = false;
+    }
+
+    // Nobody is left to receive whatever was still queued
+    for (IEventSource* source : sources_)
+    {
+        source->Clear();
+    }
+
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+
+    for (auto& queue : queues_)
+    {
+        if (queue)
+        {
+            queue->Clear();
+        }
+    }
+
+    posted_queues_.clear();
+}
+
+void EventBus::SetDownstream(EventBus* event_bus)
+{
+    downstream_ = event_bus;
+
+    if (downstream_)
+    {
+        downstream_->SetStatsEnabled(IsStatsEnabled());
+    }
+}
+
+void EventBus::SetSubscriberName(SubscriptionId id, std::string_view name)
+{
+    if (id.type >= channels_.size() || !channels_[id.type])
+    {
+        return;
+    }
+
+    Channel& channel = *channels_[id.type];
+
+    if (id.slot < channel.slots.size() &&
+        channel.slots[id.slot].generation == id.generation)
+    {
+        channel.slot_stats[id.slot].name = name;
+    }
+}
+
+void EventBus::SetStatsEnabled(bool enabled)
+{
+    stats_enabled_.store(enabled, std::memory_order_relaxed);
+
+    if (downstream_)
+    {
+        downstream_->SetStatsEnabled(enabled);
+    }
+}
+
+bool EventBus::IsStatsEnabled() const
+{
+    return stats_enabled_.load(std::memory_order_relaxed);
+}
+
+void EventBus::CaptureStats()
+{
+    if (stats_reset_requested_.exchange(false))
+    {
+        for (auto& channel : channels_)
+        {
+            if (!channel)
+            {
+                continue;
+            }
+
+            channel->publishes = 0;
+            channel->total_publishes = 0;
+
+            for (SubscriberStats& stats : channel->slot_stats)
+            {
+                stats.calls = 0;
+                stats.total_ms = 0.0;
+                stats.max_ms = 0.0;
+            }
+        }
+
+        stats_.clear();
+    }
+
+    if (IsStatsEnabled())
+    {
+        stats_.clear();
+
+        for (auto& channel : channels_)
+        {
+            if (!channel || channel->total_publishes == 0)
+            {
+                continue;
+            }
+
+            EventStats& event = stats_.emplace_back();
+            event.name = channel->name;
+            event.publishes = channel->publishes;
+            event.total_publishes = channel->total_publishes;
+
+            for (const Subscriber& subscriber : channel->subscribers)
+            {
+                if (subscriber.instance)
+                {
+                    event.subscribers.push_back(
+                        channel->slot_stats[subscriber.slot]);
+                }
+            }
+
+            event.subscriber_count = event.subscribers.size();
+            std::sort(event.subscribers.begin(), event.subscribers.end(),
+                      [](const SubscriberStats& a, const SubscriberStats& b)
+                      { return a.total_ms > b.total_ms; });
+
+            channel->publishes = 0;
+        }
+    }
+
+    if (downstream_)
+    {
+        downstream_->CaptureStats();
+    }
+}
+
+void EventBus::ResetStats()
+{
+    stats_reset_requested_ = true;
+
+    if (downstream_)
+    {
+        downstream_->ResetStats();
+    }
+}
+
+const vector<EventBus::EventStats>& EventBus::GetStats() const
+{
+    return stats_;
+}
+
+EventBus::SubscriptionId EventBus::AddSubscriber(EventTypeId type,
+                                                 void* instance,
+                                                 const char* event_name,
+                                                 const char* subscriber_name)
+{
+    if (!channels_[type])
+    {
+        channels_[type] = std::make_unique<Channel>();
+        channels_[type]->name = event_name;
+    }
+
+    Channel& channel = *channels_[type];
+    uint32_t slot;
+
+    if (channel.free_slots.empty())
+    {
+        slot = static_cast<uint32_t>(channel.slots.size());
+        channel.slots.push_back(Slot{.index = 0, .generation = 0});
+        channel.slot_stats.emplace_back();
+    }
+    else
+    {
+        slot = channel.free_slots.back();
+        channel.free_slots.pop_back();
+    }
+
+    // A reused slot starts over, it's a different subscriber now
+    channel.slot_stats[slot] = SubscriberStats{.name = subscriber_name,
+                                               .calls = 0,
+                                               .total_ms = 0.0,
+                                               .max_ms = 0.0};
+
+    channel.slots[slot].index =
+        static_cast<uint32_t>(channel.subscribers.size());
+    channel.subscribers.push_back(
+        Subscriber{.instance = instance, .slot = slot});
+
+    return SubscriptionId{.type = type,
+                          .slot = slot,
+                          .generation = channel.slots[slot].generation};
+}
+
+void EventBus::RemoveSubscriber(Channel& channel, uint32_t index)
+{
+    const uint32_t slot = channel.subscribers[index].slot;
+
+    // Order between subscribers of the same event isn't guaranteed anyway
+    if (index != channel.subscribers.size() - 1)
+    {
+        channel.subscribers[index] = channel.subscribers.back();
+        channel.slots[channel.subscribers[index].slot].index = index;
+    }
+
+    channel.subscribers.pop_back();
+    channel.free_slots.push_back(slot);
+}
+
+void EventBus::RemoveMarkedSubscribers(Channel& channel)
+{
+    // Backwards, so whatever gets swapped in was already checked
+    for (size_t i = channel.subscribers.size(); i > 0; i--)
+    {
+        if (!channel.subscribers[i - 1].instance)
+        {
+            RemoveSubscriber(channel, static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    channel.has_removed = false;
+}
+
+void EventBus::RecordCall(Channel& channel, uint32_t slot,
+                          Clock::duration time)
+{
+    const double ms = std::chrono::duration<double, std::milli>(time).count();
+
+    SubscriberStats& stats = channel.slot_stats[slot];
+    stats.calls++;
+    stats.total_ms += ms;
+    stats.max_ms = std::max(stats.max_ms, ms);
+}
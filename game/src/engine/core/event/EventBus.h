@@ -1,33 +1,72 @@
 #pragma once
 
-#include <functional>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <object_ptr.hpp>
-#include <typeindex>
-#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
+#include "engine/core/debug/Profiler.h"
+#include "engine/core/debug/TypeName.h"
 #include "engine/core/event/Event.h"
-#include "engine/core/event/EventHandler.h"
+#include "engine/core/event/EventDispatcher.h"
+#include "engine/core/event/EventQueue.h"
 
 class EventBus;
+class IEventSource;
 
+/**
+ * Each event type gets its own channel, an array of subscribers found by the
+ * type's EventTypeId. Publishing is an index into the channels and one
+ * virtual call per subscriber, with no hashing and no allocation.
+ *
+ * Publish delivers right away, nested inside whatever is publishing. Post
+ * queues a copy instead, delivered in a batch by the next Flush.
+ *
+ * With stats enabled, every handler call is timed and counted against its
+ * subscriber, and CaptureStats turns the counters into a per frame report
+ */
 class EventBus
 {
-    // Must be declared at top since it's used in the public section below
-  private:
-    static inline uint32_t kNextId = 0;
-
   public:
-    struct Subscription
+    /**
+     * Handle to one subscription, which knows its channel and slot so it can
+     * be removed without searching. Goes stale once unsubscribed or cleared
+     */
+    struct SubscriptionId
     {
-        uint32_t id;
-        std::unique_ptr<EventHandler> handler;
+        EventTypeId type;
+        uint32_t slot;
+        uint32_t generation;
     };
 
-    EventBus() : subscribers_{}, downstream_(nullptr)
+    // Times are in milliseconds, from when stats were enabled or last reset
+    struct SubscriberStats
     {
-    }
+        std::string name;
+        uint64_t calls;
+        double total_ms;
+        double max_ms;
+    };
+
+    struct EventStats
+    {
+        std::string name;
+        uint32_t publishes;
+        uint64_t total_publishes;
+        size_t subscriber_count;
+
+        // Most expensive first
+        std::vector<SubscriberStats> subscribers;
+    };
+
+    EventBus();
 
     template <class EventType>
     void Publish()
@@ -38,12 +77,11 @@ class EventBus
     template <class EventType>
     void Publish(const EventType* event)
     {
-        std::type_index key = typeid(EventType);
+        PROFILE_SCOPE(debug::GetTypeName<EventType>());
 
-        for (auto& subscriber : subscribers_[key])
-        {
-            subscriber.handler->Exec(event);
-        }
+        ForEachSubscriber<EventType>(
+            [event](IEventSubscriber<EventType>* subscriber)
+            { EventDispatcher::Dispatch<EventType>(subscriber, event); });
 
         // Forward event to all downstream busses
         if (downstream_)
@@ -52,57 +90,242 @@ class EventBus
         }
     }
 
+    // Every subscriber gets all of the events in order, one after the other
     template <class EventType>
-    uint32_t Subscribe(IEventSubscriber<EventType>* instance)
+    void PublishBatch(const std::vector<EventType>& events)
     {
-        std::type_index key = typeid(EventType);
-
-        Subscription sub = {
-            .id = kNextId,
-            .handler = std::make_unique<ComponentEventSubscriber<EventType>>(
-                instance)};
+        PROFILE_SCOPE(debug::GetTypeName<EventType>());
 
-        kNextId++;
-        subscribers_[key].push_back(std::move(sub));
+        ForEachSubscriber<EventType>(
+            [&events](IEventSubscriber<EventType>* subscriber)
+            {
+                for (const EventType& event : events)
+                {
+                    EventDispatcher::Dispatch<EventType>(subscriber, &event);
+                }
+            });
 
-        return sub.id;
+        if (downstream_)
+        {
+            downstream_->PublishBatch<EventType>(events);
+        }
     }
 
-    void Unsubscribe(uint32_t id)
+    /**
+     * Queues a copy of the event for the next Flush, instead of delivering it
+     * right away. Safe to call from any thread, and from inside a handler
+     */
+    template <class EventType>
+    void Post(const EventType& event)
     {
-        // This is super inefficient, but oeh well...
-        auto sub_types_iter = subscribers_.begin();
+        const EventTypeId type = GetEventTypeId<EventType>();
+        std::lock_guard<std::mutex> lock(queue_mutex_);
 
-        while (sub_types_iter != subscribers_.end())
+        if (type >= queues_.size())
         {
-            auto sub_iter = sub_types_iter->second.begin();
+            queues_.resize(type + 1);
+        }
 
-            while (sub_iter != sub_types_iter->second.end())
-            {
-                if (sub_iter->id == id)
-                {
-                    sub_types_iter->second.erase(sub_iter);
-                    return;
-                }
+        std::unique_ptr<IEventQueue>& queue = queues_[type];
 
-                sub_iter++;
-            }
+        if (!queue)
+        {
+            queue = std::make_unique<EventQueue<EventType>>();
+        }
 
-            sub_types_iter++;
+        if (static_cast<EventQueue<EventType>*>(queue.get())->Push(event))
+        {
+            posted_queues_.push_back(queue.get());
         }
     }
 
-    void ClearSubscribers()
-    {
-        subscribers_.clear();
-    }
+    /**
+     * Delivers everything pushed to the sources and posted since the last
+     * flush, then flushes the downstream bus. Events posted by the handlers
+     * wait for the next flush
+     */
+    void Flush();
 
-    void SetDownstream(EventBus* event_bus)
+    // Sources have to outlive the bus, or be removed first
+    void AddSource(IEventSource* source);
+    void RemoveSource(IEventSource* source);
+
+    template <class EventType>
+    SubscriptionId Subscribe(IEventSubscriber<EventType>* instance)
     {
-        downstream_ = event_bus;
+        const char* subscriber_name = "Unknown";
+
+        // Names it after the subscriber's actual type, until it's given a
+        // better one with SetSubscriberName
+        if constexpr (std::is_polymorphic_v<IEventSubscriber<EventType>>)
+        {
+            subscriber_name = debug::GetTypeName(typeid(*instance));
+        }
+
+        return AddSubscriber(GetEventTypeId<EventType>(), instance,
+                             debug::GetTypeName<EventType>(), subscriber_name);
     }
 
+    /**
+     * Moves the channel's last subscriber into the removed one's place. While
+     * that channel is being published, the subscriber is only marked instead,
+     * and taken out once the publish is done. Stale ids are ignored
+     */
+    void Unsubscribe(SubscriptionId id);
+
+    void ClearSubscribers();
+
+    void SetDownstream(EventBus* event_bus);
+
+    // Shown in the stats instead of the subscriber's type name
+    void SetSubscriberName(SubscriptionId id, std::string_view name);
+
+    // Off by default, since timing every handler call isn't free. Applies to
+    // the downstream bus too
+    void SetStatsEnabled(bool enabled);
+    bool IsStatsEnabled() const;
+
+    /**
+     * Snapshots the counters into GetStats, then captures the downstream bus.
+     * Call once a frame while nothing is publishing. The last snapshot stays
+     * around while stats are disabled
+     */
+    void CaptureStats();
+
+    // Applied by the next CaptureStats, so it's safe while publishing
+    void ResetStats();
+
+    const std::vector<EventStats>& GetStats() const;
+
   private:
-    std::unordered_map<std::type_index, std::vector<Subscription>> subscribers_;
+    using Clock = std::chrono::steady_clock;
+
+    struct Subscriber
+    {
+        // Always an IEventSubscriber<EventType>* of the channel's event type,
+        // or nullptr once unsubscribed in the middle of a publish
+        void* instance;
+        uint32_t slot;
+    };
+
+    struct Slot
+    {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+    struct Channel
+    {
+        const char* name = nullptr;
+
+        // Packed, so publishing walks a single array
+        std::vector<Subscriber> subscribers;
+
+        // Index of each handle's subscriber, slots are reused once freed
+        std::vector<Slot> slots;
+        std::vector<uint32_t> free_slots;
+
+        // Indexed by slot like the above, only counted while stats are on
+        std::vector<SubscriberStats> slot_stats;
+        uint32_t publishes = 0;
+        uint64_t total_publishes = 0;
+
+        // Each event type is published from one thread at a time, so these
+        // don't need to be atomic
+        uint32_t publish_depth = 0;
+        bool has_removed = false;
+    };
+
+    // Indexed by EventTypeId. Fixed size, so adding a channel never moves the
+    // ones other threads may be publishing at the same time
+    std::array<std::unique_ptr<Channel>, kMaxEventTypes> channels_;
+
+    // Also indexed by EventTypeId, only created once a type is posted
+    std::vector<std::unique_ptr<IEventQueue>> queues_;
+
+    // Queues with events waiting, double buffered so Flush can deliver
+    // without holding the lock
+    std::vector<IEventQueue*> posted_queues_;
+    std::vector<IEventQueue*> flushing_queues_;
+    std::mutex queue_mutex_;
+
+    // Lock free queues other threads push to, drained on Flush
+    std::vector<IEventSource*> sources_;
+
+    std::atomic<bool> stats_enabled_;
+    std::atomic<bool> stats_reset_requested_;
+    std::vector<EventStats> stats_;
+
     jss::object_ptr<EventBus> downstream_;
+
+    SubscriptionId AddSubscriber(EventTypeId type, void* instance,
+                                 const char* event_name,
+                                 const char* subscriber_name);
+    void RemoveSubscriber(Channel& channel, uint32_t index);
+    void RemoveMarkedSubscribers(Channel& channel);
+    void RecordCall(Channel& channel, uint32_t slot, Clock::duration time);
+
+    template <class EventType, class Function>
+    void ForEachSubscriber(Function&& function)
+    {
+        const EventTypeId type = GetEventTypeId<EventType>();
+
+        // Only this type's channel is touched, so services updating on
+        // different threads can publish different event types at once
+        if (!channels_[type])
+        {
+            return;
+        }
+
+        Channel& channel = *channels_[type];
+
+        // Anything subscribed by a handler waits for the next publish
+        const size_t count = channel.subscribers.size();
+        const bool timed = stats_enabled_.load(std::memory_order_relaxed);
+        channel.publish_depth++;
+
+        if (timed)
+        {
+            channel.publishes++;
+            channel.total_publishes++;
+        }
+
+        // Indexed, since subscribing from a handler can reallocate the array
+        for (size_t i = 0; i < count; i++)
+        {
+            const Subscriber subscriber = channel.subscribers[i];
+
+            if (!subscriber.instance)
+            {
+                continue;
+            }
+
+            auto* instance =
+                static_cast<IEventSubscriber<EventType>*>(subscriber.instance);
+
+            if (!timed)
+            {
+                function(instance);
+                continue;
+            }
+
+            const Clock::time_point start = Clock::now();
+            function(instance);
+            RecordCall(channel, subscriber.slot, Clock::now() - start);
+        }
+
+        channel.publish_depth--;
+
+        if (channel.publish_depth == 0 && channel.has_removed)
+        {
+            RemoveMarkedSubscribers(channel);
+        }
+    }
 };
+
+template <class EventType>
+void EventQueue<EventType>::Deliver(EventBus& bus)
+{
+    bus.PublishBatch<EventType>(delivering_);
+    delivering_.clear();
+}
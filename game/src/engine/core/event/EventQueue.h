@@ -0,0 +1,53 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+class EventBus;
+
+// Events posted to an EventBus, waiting to be delivered by its next Flush
+class IEventQueue
+{
+  public:
+    virtual ~IEventQueue() = default;
+
+    // Moves the posted events aside, so handlers can post while delivering
+    virtual void Swap() = 0;
+    virtual void Deliver(EventBus& bus) = 0;
+    virtual void Clear() = 0;
+};
+
+template <class EventType>
+class EventQueue final : public IEventQueue
+{
+  public:
+    EventQueue() : posted_{}, delivering_{}
+    {
+    }
+
+    // Returns whether it's the first event posted since the last swap
+    bool Push(const EventType& event)
+    {
+        posted_.push_back(event);
+        return posted_.size() == 1;
+    }
+
+    void Swap() override
+    {
+        // Both keep their capacity, so a steady stream doesn't allocate
+        std::swap(posted_, delivering_);
+    }
+
+    // Defined in EventBus.h, which needs this to be complete first
+    void Deliver(EventBus& bus) override;
+
+    void Clear() override
+    {
+        posted_.clear();
+        delivering_.clear();
+    }
+
+  private:
+    std::vector<EventType> posted_;
+    std::vector<EventType> delivering_;
+};
@@ -0,0 +1,357 @@
+#include "engine/core/jobs/JobSystem.h"
+
+#include <algorithm>
+
+#include "engine/core/debug/Log.h"
+
+using std::vector;
+
+// Batches handed out per thread by ParallelFor, so uneven work still balances
+static constexpr size_t kBatchesPerThread = 4;
+
+static thread_local JobSystem* kWorkerOwner = nullptr;
+static thread_local size_t kWorkerIndex = 0;
+
+static size_t DefaultWorkerCount()
+{
+    const size_t hardware_threads = std::thread::hardware_concurrency();
+    return hardware_threads > 1 ? hardware_threads - 1 : 0;
+}
+
+JobSystem::JobSystem() : JobSystem(DefaultWorkerCount())
+{
+}
+
+JobSystem::JobSystem(size_t worker_count)
+    : queues_{},
+      shared_queue_{},
+      background_queue_{},
+      workers_{},
+      pending_(0),
+      background_pending_(0),
+      background_running_(0),
+      background_limit_(
+          static_cast<uint32_t>(std::max<size_t>(worker_count, 2) - 1)),
+      stopping_(false),
+      sleep_mutex_{},
+      sleep_cv_{},
+      wait_cv_{}
+{
+    for (size_t i = 0; i < worker_count; i++)
+    {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (size_t i = 0; i < worker_count; i++)
+    {
+        workers_.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+
+    debug::LogDebug("[JobSystem] Started {} worker threads", worker_count);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+
+    sleep_cv_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void JobSystem::Submit(Job job, JobCounter* counter)
+{
+    // Nobody else would ever pick the job up
+    if (workers_.empty())
+    {
+        job();
+        return;
+    }
+
+    if (counter)
+    {
+        counter->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    WorkerQueue& queue =
+        IsWorkerThread() ? *queues_[kWorkerIndex] : shared_queue_;
+
+    {
+        std::lock_guard lock(sleep_mutex_);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.jobs.push_back(QueuedJob{.job = std::move(job), .counter = counter});
+    }
+
+    sleep_cv_.notify_one();
+
+    // A waiter may be the only thread free to run it
+    wait_cv_.notify_one();
+}
+
+void JobSystem::SubmitBackground(Job job, JobCounter* counter)
+{
+    if (workers_.empty())
+    {
+        job();
+        return;
+    }
+
+    if (counter)
+    {
+        counter->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard lock(sleep_mutex_);
+        background_pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard lock(background_queue_.mutex);
+        background_queue_.jobs.push_back(
+            QueuedJob{.job = std::move(job), .counter = counter});
+    }
+
+    sleep_cv_.notify_one();
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    while (counter.load(std::memory_order_acquire) > 0)
+    {
+        if (RunPendingJob())
+        {
+            continue;
+        }
+
+        // Whatever is left runs elsewhere, likely a background job, so sleep
+        // instead of spinning until it's done
+        std::unique_lock lock(sleep_mutex_);
+        wait_cv_.wait(lock,
+                      [this, &counter]()
+                      {
+                          return counter.load(std::memory_order_acquire) == 0 ||
+                                 pending_.load(std::memory_order_relaxed) > 0;
+                      });
+    }
+}
+
+bool JobSystem::RunPendingJob()
+{
+    QueuedJob queued;
+
+    if (!TakeJob(queued))
+    {
+        return false;
+    }
+
+    Execute(queued);
+    return true;
+}
+
+void JobSystem::ParallelFor(size_t count, size_t min_batch, const RangeJob& job)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const size_t threads = workers_.size() + 1;
+    const size_t target_batch =
+        (count + threads * kBatchesPerThread - 1) / (threads * kBatchesPerThread);
+    const size_t batch = std::max({min_batch, target_batch, size_t(1)});
+
+    if (batch >= count || workers_.empty())
+    {
+        job(0, count);
+        return;
+    }
+
+    JobCounter counter = 0;
+
+    for (size_t begin = batch; begin < count; begin += batch)
+    {
+        const size_t end = std::min(begin + batch, count);
+        Submit([&job, begin, end]() { job(begin, end); }, &counter);
+    }
+
+    // The calling thread takes the first batch itself
+    job(0, batch);
+    Wait(counter);
+}
+
+size_t JobSystem::GetWorkerCount() const
+{
+    return workers_.size();
+}
+
+bool JobSystem::IsWorkerThread() const
+{
+    return kWorkerOwner == this;
+}
+
+bool JobSystem::IsAnyWorkerThread()
+{
+    return kWorkerOwner != nullptr;
+}
+
+void JobSystem::WorkerLoop(size_t index)
+{
+    kWorkerOwner = this;
+    kWorkerIndex = index;
+
+    while (true)
+    {
+        QueuedJob queued;
+
+        // Frame jobs always go first
+        if (TakeJob(queued))
+        {
+            Execute(queued);
+            continue;
+        }
+
+        if (TakeBackgroundJob(queued))
+        {
+            ExecuteBackground(queued);
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        sleep_cv_.wait(lock, [this]() { return stopping_ || HasWork(); });
+
+        // Drain everything before shutting down
+        if (stopping_ && pending_.load(std::memory_order_relaxed) == 0 &&
+            background_pending_.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+    }
+}
+
+bool JobSystem::TakeJob(QueuedJob& out)
+{
+    if (pending_.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    const bool is_worker = IsWorkerThread();
+
+    // Newest job from our own deque first, it's most likely still in cache
+    if (is_worker)
+    {
+        WorkerQueue& own = *queues_[kWorkerIndex];
+        std::lock_guard lock(own.mutex);
+
+        if (!own.jobs.empty())
+        {
+            out = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    {
+        std::lock_guard lock(shared_queue_.mutex);
+
+        if (!shared_queue_.jobs.empty())
+        {
+            out = std::move(shared_queue_.jobs.front());
+            shared_queue_.jobs.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal the oldest job from someone else
+    const size_t start = is_worker ? kWorkerIndex + 1 : 0;
+
+    for (size_t i = 0; i < queues_.size(); i++)
+    {
+        WorkerQueue& victim = *queues_[(start + i) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+
+        if (!victim.jobs.empty())
+        {
+            out = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool JobSystem::TakeBackgroundJob(QueuedJob& out)
+{
+    if (background_pending_.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    std::lock_guard lock(background_queue_.mutex);
+
+    // Keeps a worker free for frame jobs
+    if (background_queue_.jobs.empty() ||
+        background_running_.load(std::memory_order_relaxed) >=
+            background_limit_)
+    {
+        return false;
+    }
+
+    out = std::move(background_queue_.jobs.front());
+    background_queue_.jobs.pop_front();
+    background_running_.fetch_add(1, std::memory_order_relaxed);
+    background_pending_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::HasWork() const
+{
+    return pending_.load(std::memory_order_relaxed) > 0 ||
+           (background_pending_.load(std::memory_order_relaxed) > 0 &&
+            background_running_.load(std::memory_order_relaxed) <
+                background_limit_);
+}
+
+void JobSystem::Execute(QueuedJob& queued)
+{
+    queued.job();
+
+    if (!queued.counter ||
+        queued.counter->fetch_sub(1, std::memory_order_release) != 1)
+    {
+        return;
+    }
+
+    // Locked so a waiter can't miss it between checking and sleeping. The
+    // counter may already be gone, since the waiter is free to return
+    std::lock_guard lock(sleep_mutex_);
+    wait_cv_.notify_all();
+}
+
+void JobSystem::ExecuteBackground(QueuedJob& queued)
+{
+    Execute(queued);
+
+    // Frees up a background slot, which a sleeping worker may be waiting for
+    {
+        std::lock_guard lock(sleep_mutex_);
+        background_running_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    sleep_cv_.notify_one();
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Number of jobs still running, used to wait for a group of jobs
+using JobCounter = std::atomic<uint32_t>;
+
+/**
+ * Work-stealing thread pool shared by the whole engine. Every worker owns a
+ * deque: it pushes and pops its own jobs from the back, and steals from the
+ * front of other workers' deques when it runs out. Jobs submitted from
+ * outside the pool go into a shared queue.
+ *
+ * Threads waiting on a counter run pending jobs while there are any, so jobs
+ * can safely wait on other jobs, and sleep once there's nothing left to help
+ * with.
+ *
+ * Slow work that isn't needed this frame, like loading a scene, goes into a
+ * separate background queue. Only workers take from it, and never all of
+ * them at once, so a frame waiting on its own jobs can't get stuck running
+ * someone else's mesh cooking.
+ */
+class JobSystem
+{
+  public:
+    using Job = std::function<void()>;
+    using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+    // Uses one worker per hardware thread, minus the main thread
+    JobSystem();
+    JobSystem(size_t worker_count);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void Submit(Job job, JobCounter* counter = nullptr);
+    void SubmitBackground(Job job, JobCounter* counter = nullptr);
+    void Wait(JobCounter& counter);
+
+    // Runs one pending job on the calling thread, returns false if none.
+    // Never picks up background jobs
+    bool RunPendingJob();
+
+    /**
+     * Splits [0, count) into batches of at least min_batch items and runs
+     * them across the pool, including the calling thread. Returns once every
+     * batch has finished
+     */
+    void ParallelFor(size_t count, size_t min_batch, const RangeJob& job);
+
+    size_t GetWorkerCount() const;
+    bool IsWorkerThread() const;
+
+    // Same as IsWorkerThread, but for the workers of any job system
+    static bool IsAnyWorkerThread();
+
+  private:
+    struct QueuedJob
+    {
+        Job job;
+        JobCounter* counter;
+    };
+
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<QueuedJob> jobs;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    WorkerQueue shared_queue_;
+    WorkerQueue background_queue_;
+    std::vector<std::thread> workers_;
+
+    // Counted before the job is queued, so taking it can never underflow
+    std::atomic<uint32_t> pending_;
+    std::atomic<uint32_t> background_pending_;
+
+    // Workers busy with background jobs, at most background_limit_
+    std::atomic<uint32_t> background_running_;
+    uint32_t background_limit_;
+
+    std::atomic<bool> stopping_;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+
+    // Wakes threads in Wait when a counter drops to zero or a job shows up
+    std::condition_variable wait_cv_;
+
+    void WorkerLoop(size_t index);
+    bool TakeJob(QueuedJob& out);
+    bool TakeBackgroundJob(QueuedJob& out);
+    bool HasWork() const;
+    void Execute(QueuedJob& queued);
+    void ExecuteBackground(QueuedJob& queued);
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+#include "engine/core/math/Timestep.h"
+
+/**
+ * Timing for one iteration of the game loop. The App computes it once at the
+ * start of the frame and hands the same copy to every service, so nothing
+ * reads the clock on its own
+ */
+struct FrameContext
+{
+    // Frames completed before this one
+    uint64_t index = 0;
+
+    // Time since the previous frame started
+    Timestep delta_time;
+
+    // Sum of every delta so far, which is how far the game has simulated
+    Timestep elapsed_time;
+};
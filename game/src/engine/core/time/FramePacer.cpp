@@ -0,0 +1,92 @@
+#include "engine/core/time/FramePacer.h"
+
+#include <algorithm>
+#include <thread>
+
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+// Short sleeps, so one that overshoots can't blow through the deadline
+static constexpr microseconds kSleepSlice(1000);
+static constexpr microseconds kInitialSleepOvershoot(2000);
+
+FramePacer::FramePacer()
+    : max_fps_(0.0),
+      ticked_(false),
+      last_tick_(Clock::now()),
+      deadline_(Clock::now()),
+      sleep_overshoot_(kInitialSleepOvershoot)
+{
+}
+
+Timestep FramePacer::Tick()
+{
+    const Clock::time_point now = Clock::now();
+    const duration<double> delta = now - last_tick_;
+    last_tick_ = now;
+
+    if (!ticked_)
+    {
+        ticked_ = true;
+        return Timestep();
+    }
+
+    return Timestep::Seconds(delta.count());
+}
+
+void FramePacer::Wait()
+{
+    if (max_fps_ <= 0.0)
+    {
+        return;
+    }
+
+    const Clock::duration period =
+        duration_cast<Clock::duration>(duration<double>(1.0 / max_fps_));
+
+    // Deadlines advance by a fixed period, so sleep errors don't accumulate
+    deadline_ += period;
+    Clock::time_point now = Clock::now();
+
+    if (now >= deadline_)
+    {
+        // Far behind after a hitch, start over instead of rushing through a
+        // burst of uncapped frames to catch up
+        if (now - deadline_ > period)
+        {
+            deadline_ = now;
+        }
+
+        return;
+    }
+
+    while (deadline_ - now > kSleepSlice + sleep_overshoot_)
+    {
+        const Clock::time_point before = now;
+        std::this_thread::sleep_for(kSleepSlice);
+        now = Clock::now();
+
+        // Track the worst recent overshoot, decaying so one bad wake up
+        // doesn't turn every frame into a spin
+        const Clock::duration overshoot = (now - before) - kSleepSlice;
+        sleep_overshoot_ =
+            std::max(overshoot, sleep_overshoot_ - sleep_overshoot_ / 8);
+    }
+
+    while (Clock::now() < deadline_)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::SetMaxFps(double max_fps)
+{
+    max_fps_ = std::max(max_fps, 0.0);
+    deadline_ = Clock::now();
+}
+
+double FramePacer::GetMaxFps() const
+{
+    return max_fps_;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+
+#include "engine/core/math/Timestep.h"
+
+/**
+ * Measures frame times and optionally caps the frame rate. Waiting sleeps
+ * while there's plenty of time left, then spins through the last stretch,
+ * since sleeping tends to overshoot by more than a frame can afford
+ */
+class FramePacer
+{
+  public:
+    FramePacer();
+
+    // Time since the previous call, zero on the first one
+    Timestep Tick();
+
+    // Blocks until the next frame is due, returns immediately when uncapped
+    void Wait();
+
+    // 0 leaves the frame rate uncapped
+    void SetMaxFps(double max_fps);
+    double GetMaxFps() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    double max_fps_;
+    bool ticked_;
+    Clock::time_point last_tick_;
+    Clock::time_point deadline_;
+
+    // How far past the requested time a short sleep usually wakes up
+    Clock::duration sleep_overshoot_;
+};
@@ -10,7 +10,10 @@ class InputService;
 class PhysicsService;
 class RenderService;
 class SceneDebugService;
+class SceneSnapshotService;
 class PickupService;
+class PrefabService;
+class ProfilerService;
 
 /* Forward declarations of common scene objects */
 
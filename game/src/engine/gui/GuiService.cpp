@@ -47,10 +47,10 @@ void GuiService::OnStart(ServiceProvider& service_provider)
 {
 }
 
-void GuiService::OnUpdate()
+void GuiService::OnUpdate(const FrameContext& frame)
 {
-    // Render ImGui frame
-    glDisable(GL_FRAMEBUFFER_SRGB);
+    // Build the ImGui frame while the simulation is idle, so GUI handlers can
+    // read game state directly
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
@@ -59,6 +59,11 @@ void GuiService::OnUpdate()
     GetEventBus().Publish<OnGuiEvent>();
 
     ImGui::Render();
+}
+
+void GuiService::OnRender()
+{
+    glDisable(GL_FRAMEBUFFER_SRGB);
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
 
@@ -15,7 +15,8 @@ class GuiService final : public Service
     // From Service
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
+    void OnRender() override;
     void OnCleanup() override;
     std::string_view GetName() const override;
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+#include "engine/App.h"
 #include "engine/core/debug/Assert.h"
 #include "engine/core/debug/Log.h"
 #include "engine/input/Gamepad.h"
@@ -195,12 +196,14 @@ void InputService::OnInit()
 {
     GetEventBus().Subscribe<OnGuiEvent>(this);
 
-    // Check if any gamepads are connected
+    // Check if any gamepads are connected, GLFW isn't available headless
+    const bool headless = GetApp().IsHeadless();
+
     for (int i = 0; i < static_cast<int>(Gamepad::kGamepadCount); i++)
     {
         Gamepad gamepad(i);
 
-        if (gamepad.Connect())
+        if (!headless && gamepad.Connect())
         {
             debug::LogInfo("Found controller, ID: {}", i);
         }
@@ -219,7 +222,15 @@ std::string_view InputService::GetName() const
     return "InputService";
 }
 
-void InputService::OnUpdate()
+ServiceAccess InputService::GetAccess() const
+{
+    // GLFW joystick functions are main thread only
+    return ServiceAccess{.reads = service_access::kNone,
+                         .writes = service_access::kInput,
+                         .main_thread = true};
+}
+
+void InputService::OnUpdate(const FrameContext& frame)
 {
     // Update keys in keyboard state map
     for (auto& state : kButtonStateMap)
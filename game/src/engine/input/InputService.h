@@ -96,9 +96,10 @@ class InputService final : public Service, public IEventSubscriber<OnGuiEvent>
 
     // From Service
     void OnInit() override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     // From Event subscribers
     void OnGui() override;
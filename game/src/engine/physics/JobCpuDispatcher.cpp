@@ -0,0 +1,29 @@
+#include "engine/physics/JobCpuDispatcher.h"
+
+#include "engine/core/debug/Profiler.h"
+
+JobCpuDispatcher::JobCpuDispatcher(JobSystem& job_system)
+    : job_system_(&job_system)
+{
+}
+
+void JobCpuDispatcher::submitTask(physx::PxBaseTask& task)
+{
+    job_system_->Submit(
+        [&task]()
+        {
+            PROFILE_SCOPE(task.getName());
+            task.run();
+            task.release();
+        });
+}
+
+uint32_t JobCpuDispatcher::getWorkerCount() const
+{
+    return static_cast<uint32_t>(job_system_->GetWorkerCount());
+}
+
+void JobCpuDispatcher::release()
+{
+    delete this;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <object_ptr.hpp>
+
+#include "PxPhysicsAPI.h"
+#include "engine/core/jobs/JobSystem.h"
+
+/**
+ * Runs PhysX tasks on the engine's JobSystem, so the simulation shares its
+ * threads with the rest of the engine instead of spawning its own
+ */
+class JobCpuDispatcher final : public physx::PxCpuDispatcher
+{
+  public:
+    JobCpuDispatcher(JobSystem& job_system);
+
+    // From PxCpuDispatcher
+    void submitTask(physx::PxBaseTask& task) override;
+    uint32_t getWorkerCount() const override;
+
+    // Matches the PhysX objects around it, so it works with PX_RELEASE
+    void release();
+
+  private:
+    jss::object_ptr<JobSystem> job_system_;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "engine/core/debug/Assert.h"
+#include "engine/core/event/EventBus.h"
+#include "engine/core/event/EventDispatcher.h"
+
+class Entity;
+
+// A trigger pair PhysX reported during the last tick
+struct OnPhysicsTriggerEvent : public IEvent
+{
+    Entity* trigger;
+    Entity* other;
+    bool enter;
+};
+
+template <>
+class IEventSubscriber<OnPhysicsTriggerEvent>
+{
+  public:
+    virtual void OnPhysicsTrigger(const OnPhysicsTriggerEvent& event) = 0;
+};
+
+STATIC_ASSERT_INTERFACE(IEventSubscriber<OnPhysicsTriggerEvent>);
+
+template <>
+inline void EventDispatcher::Dispatch<OnPhysicsTriggerEvent>(
+    IEventSubscriber<OnPhysicsTriggerEvent>* subscriber,
+    const OnPhysicsTriggerEvent* event)
+{
+    ASSERT_MSG(event != nullptr,
+               "OnPhysicsTrigger should have valid event data");
+    subscriber->OnPhysicsTrigger(*event);
+}
@@ -1,5 +1,7 @@
 #include "engine/physics/PhysicsService.h"
 
+#include <algorithm>
+#include <cmath>
 #include <glm/glm.hpp>
 #include <optional>
 
@@ -8,11 +10,16 @@
 #include "engine/App.h"
 #include "engine/asset/AssetService.h"
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/core/math/Physx.h"
 #include "engine/gui/GuiService.h"
 #include "engine/input/InputService.h"
+#include "engine/physics/JobCpuDispatcher.h"
+#include "engine/physics/RigidBodyComponent.h"
 #include "engine/render/RenderService.h"
 #include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
+#include "engine/scene/Transform.h"
 #include "engine/service/ServiceProvider.h"
 
 using snippetvehicle2::BaseVehicle;
@@ -23,13 +30,16 @@ using namespace physx;
 using namespace physx::vehicle2;
 
 static constexpr bool kPhysxRecordAllocations = true;
-static constexpr uint32_t kPhysxCpuThreads = 2;
 static constexpr const char* kPvdHost = "127.0.0.1";
 static constexpr int kPvdPort = 5425;
 static constexpr uint32_t kPvdTimeoutMillis = 10;
 static const Timestep kPhysxTimestep = Timestep::Seconds(1.0f / 60.0f);
 static const OnPhysicsUpdateEvent kPhysicsUpdateEventData{.step =
                                                               kPhysxTimestep};
+static constexpr uint32_t kDefaultMaxSubsteps = 4;
+static constexpr uint32_t kMaxSubstepsLimit = 16;
+// Most simulation time kept around to catch up on when dilating
+static constexpr double kMaxDilationBacklogSeconds = 0.25;
 
 static const PxVec3 kGravity(0.0f, -98.1f, 0.0f);
 // Typically speed tolerance should be gravity acceleration * 1 sec
@@ -41,12 +51,26 @@ static const PxCookingParams kDefaultPxCookingParams =
 void PhysicsService::OnInit()
 {
     GetEventBus().Subscribe<OnGuiEvent>(this);
+    GetEventBus().Subscribe<OnPhysicsTriggerEvent>(this);
+    GetEventBus().AddSource(&trigger_queue_);
 
-    prev_time_ = 0.0;
+    rate_window_start_ = 0.0;
     tick_rate_ = 0;
     tick_count_ = 0;
 
+    max_substeps_ = kDefaultMaxSubsteps;
+    substep_overflow_ = SubstepOverflow::kDrop;
+    substeps_last_frame_ = 0;
+    peak_substeps_ = 0;
+    peak_substeps_window_ = 0;
+    dropped_seconds_total_ = 0.0;
+    dropped_seconds_window_ = 0.0;
+    dropped_ms_per_second_ = 0.0;
+    simulated_seconds_window_ = 0.0;
+    time_dilation_ = 1.0;
+
     time_accumulator_.SetSeconds(0.0f);
+    interpolation_alpha_ = 1.0f;
     InitPhysX();
 }
 
@@ -54,11 +78,12 @@ void PhysicsService::OnStart(ServiceProvider& service_provider)
 {
     asset_service_ = &service_provider.GetService<AssetService>();
     input_service_ = &service_provider.GetService<InputService>();
-    render_service_ = &service_provider.GetService<RenderService>();
+    render_service_ = service_provider.TryGetService<RenderService>();
 }
 
 void PhysicsService::OnSceneLoaded(Scene& scene)
 {
+    active_scene_ = &scene;
     display_pause_ = false;
 
     if (kScene_)
@@ -67,6 +92,7 @@ void PhysicsService::OnSceneLoaded(Scene& scene)
     }
 
     time_accumulator_.SetSeconds(0.0f);
+    interpolation_alpha_ = 1.0f;
 
     PxSceneDesc scene_desc(kPhysics_->getTolerancesScale());
     scene_desc.gravity = kGravity;
@@ -97,7 +123,22 @@ void PhysicsService::OnSceneLoaded(Scene& scene)
     vehicle_context_.physxScene = kScene_;
 }
 
-void PhysicsService::OnUpdate()
+void PhysicsService::OnSceneUnloaded(Scene& scene)
+{
+    active_scene_ = nullptr;
+
+    // Whatever is left points at entities that are about to be gone
+    trigger_queue_.Clear();
+}
+
+void PhysicsService::OnSceneRestored(Scene& scene)
+{
+    // Bodies were put back in place, so there's no pose left to catch up to
+    time_accumulator_.SetSeconds(0.0f);
+    interpolation_alpha_ = 1.0f;
+}
+
+void PhysicsService::OnUpdate(const FrameContext& frame)
 {
     if (input_service_->IsKeyPressed(GLFW_KEY_ESCAPE) ||
         input_service_->IsGamepadButtonPressed(GLFW_JOYSTICK_1,
@@ -108,10 +149,9 @@ void PhysicsService::OnUpdate()
 
     if (!display_pause_)
     {
-        const Timestep& delta = GetApp().GetDeltaTime();
-        time_accumulator_ += delta;
+        time_accumulator_ += frame.delta_time;
 
-        StepPhysics();
+        StepPhysics(frame);
     }
 
     if (input_service_->IsKeyPressed(GLFW_KEY_F3))
@@ -119,7 +159,7 @@ void PhysicsService::OnUpdate()
         show_debug_menu_ = !show_debug_menu_;
     }
 
-    if (debug_draw_scene_)
+    if (debug_draw_scene_ && render_service_)
     {
         const auto& render_buffer = kScene_->getRenderBuffer();
         const PxDebugLine* lines = render_buffer.getLines();
@@ -142,6 +182,7 @@ void PhysicsService::OnUpdate()
 
 void PhysicsService::OnCleanup()
 {
+    GetEventBus().RemoveSource(&trigger_queue_);
     PxCloseVehicleExtension();
 
     PX_RELEASE(kScene_);
@@ -181,10 +222,35 @@ void PhysicsService::OnGui()
     kScene_->getSimulationStatistics(stats);
 
     ImGui::Text("Tick rate: %d", tick_rate_);
+    ImGui::Text("Interpolation alpha: %.2f", interpolation_alpha_);
+    ImGui::Text("Substeps: %u (peak %u)", substeps_last_frame_,
+                peak_substeps_);
+    ImGui::Text("Time dilation: %.2f", time_dilation_);
+    ImGui::Text("Dropped time: %.1f ms/s (%.2f s total)",
+                dropped_ms_per_second_, dropped_seconds_total_);
+
+    int max_substeps = static_cast<int>(max_substeps_);
+    if (ImGui::SliderInt("Max Substeps", &max_substeps, 1,
+                         static_cast<int>(kMaxSubstepsLimit)))
+    {
+        SetMaxSubsteps(static_cast<uint32_t>(max_substeps));
+    }
+
+    int overflow = static_cast<int>(substep_overflow_);
+    if (ImGui::Combo("Substep Overflow", &overflow, "Drop\0Dilate\0"))
+    {
+        SetSubstepOverflow(static_cast<SubstepOverflow>(overflow));
+    }
+
     ImGui::Text("Static Bodies: %u", stats.nbStaticBodies);
     ImGui::Text("Dynamic Bodies: %u", stats.nbDynamicBodies);
     ImGui::Text("Active Dynamic Bodies: %u", stats.nbActiveDynamicBodies);
     ImGui::Text("Vehicles: %u", vehicles_.size());
+    ImGui::Text("Trigger queue: %zu/%zu (peak batch %zu, %llu dropped)",
+                trigger_queue_.GetDepth(), trigger_queue_.GetCapacity(),
+                trigger_queue_.GetPeakBatchSize(),
+                static_cast<unsigned long long>(
+                    trigger_queue_.GetOverflowCount()));
 
     ImGui::Spacing();
     ImGui::Separator();
@@ -221,11 +287,54 @@ void PhysicsService::OnGui()
     ImGui::End();
 }
 
+void PhysicsService::OnPhysicsTrigger(const OnPhysicsTriggerEvent& event)
+{
+    OnTriggerEvent event_data = {.other = event.other};
+
+    for (auto& entry : event.trigger->GetComponents())
+    {
+        if (event.enter)
+        {
+            entry.component->OnTriggerEnter(event_data);
+        }
+        else
+        {
+            entry.component->OnTriggerExit(event_data);
+        }
+    }
+
+    event_data = {.other = event.trigger};
+
+    for (auto& entry : event.other->GetComponents())
+    {
+        if (event.enter)
+        {
+            entry.component->OnTriggerEnter(event_data);
+        }
+        else
+        {
+            entry.component->OnTriggerExit(event_data);
+        }
+    }
+}
+
 string_view PhysicsService::GetName() const
 {
     return "PhysicsService";
 }
 
+ServiceAccess PhysicsService::GetAccess() const
+{
+    // Stepping writes back the transforms of dynamic actors, and the debug
+    // lines go into the render service's draw list
+    return ServiceAccess{
+        .reads = service_access::kInput | service_access::kPhysics,
+        .writes = service_access::kScene | service_access::kPhysics |
+                  service_access::kRender,
+        .main_thread = true,
+        .phase = UpdatePhase::kSimulation};
+}
+
 PxRigidStatic* PhysicsService::CreatePlaneRigidStatic(const PxPlane& dimensions)
 {
     return physx::PxCreatePlane(*kPhysics_, dimensions, *kMaterial_);
@@ -233,6 +342,54 @@ PxRigidStatic* PhysicsService::CreatePlaneRigidStatic(const PxPlane& dimensions)
 
 PxTriangleMesh* PhysicsService::CreateTriangleMesh(const string& mesh_name)
 {
+    vector<PxU8> cooked_data;
+
+    {
+        std::lock_guard lock(cooked_meshes_mutex_);
+        auto iter = cooked_meshes_.find(mesh_name);
+
+        if (iter != cooked_meshes_.end())
+        {
+            cooked_data = iter->second;
+        }
+    }
+
+    // Not prepared ahead of time, so it has to be cooked right here
+    if (cooked_data.empty())
+    {
+        cooked_data = CookTriangleMesh(mesh_name);
+    }
+
+    PxDefaultMemoryInputData mesh_in_buffer(
+        cooked_data.data(), static_cast<PxU32>(cooked_data.size()));
+    PxTriangleMesh* triangle_mesh =
+        kPhysics_->createTriangleMesh(mesh_in_buffer);
+    ASSERT_MSG(triangle_mesh, "Mesh creation must succeed");
+
+    return triangle_mesh;
+}
+
+void PhysicsService::PrepareTriangleMesh(const string& mesh_name)
+{
+    {
+        std::lock_guard lock(cooked_meshes_mutex_);
+
+        if (cooked_meshes_.contains(mesh_name))
+        {
+            return;
+        }
+    }
+
+    vector<PxU8> cooked_data = CookTriangleMesh(mesh_name);
+
+    std::lock_guard lock(cooked_meshes_mutex_);
+    cooked_meshes_.insert({mesh_name, std::move(cooked_data)});
+}
+
+vector<PxU8> PhysicsService::CookTriangleMesh(const string& mesh_name)
+{
+    PROFILE_SCOPE("PhysicsService::CookTriangleMesh");
+
     // Converting our Mesh to a Px Mesh description
     const Mesh& mesh = asset_service_->GetMesh(mesh_name);
 
@@ -270,13 +427,8 @@ PxTriangleMesh* PhysicsService::CreateTriangleMesh(const string& mesh_name)
                        mesh_name);
     }
 
-    PxDefaultMemoryInputData mesh_in_buffer(cooking_out_buffer.getData(),
-                                            cooking_out_buffer.getSize());
-    PxTriangleMesh* triangle_mesh =
-        kPhysics_->createTriangleMesh(mesh_in_buffer);
-    ASSERT_MSG(triangle_mesh, "Mesh creation must succeed");
-
-    return triangle_mesh;
+    const PxU8* data = cooking_out_buffer.getData();
+    return vector<PxU8>(data, data + cooking_out_buffer.getSize());
 }
 
 PxRigidDynamic* PhysicsService::CreateRigidDynamic(const glm::vec3& position,
@@ -381,7 +533,7 @@ std::optional<RaycastData> PhysicsService::RaycastDynamic(
     kScene_->raycast(px_origin, px_unit_dir, max_distance, raycast_result,
                      hit_flags, filter_data);
 
-    if (debug_draw_raycast_)
+    if (debug_draw_raycast_ && render_service_)
     {
         DebugVertex start(PxToGlm(px_origin), Color4u(255, 0, 0, 255));
         DebugVertex end(PxToGlm(px_origin + px_unit_dir * max_distance),
@@ -426,7 +578,7 @@ std::optional<RaycastData> PhysicsService::RaycastStatic(
     kScene_->raycast(px_origin, px_unit_dir, max_distance, raycast_result,
                      hit_flags, filter_data);
 
-    if (debug_draw_raycast_)
+    if (debug_draw_raycast_ && render_service_)
     {
         DebugVertex start(PxToGlm(px_origin), Color4u(0, 0, 255, 255));
         DebugVertex end(PxToGlm(px_origin + px_unit_dir * max_distance),
@@ -462,7 +614,7 @@ void PhysicsService::InitPhysX()
                                       kDefaultErrorCallback_);
     ASSERT_MSG(kFoundation_, "PhysX must be initialized");
 
-    kDispatcher_ = physx::PxDefaultCpuDispatcherCreate(kPhysxCpuThreads);
+    kDispatcher_ = new JobCpuDispatcher(GetApp().GetJobSystem());
     ASSERT(kDispatcher_);
 
     //// For debugging purposes, initializing the physx visual debugger
@@ -514,12 +666,19 @@ void PhysicsService::InitPhysX()
         PxVehiclePhysXActorUpdateMode::eAPPLY_ACCELERATION;
 }
 
-void PhysicsService::StepPhysics()
+void PhysicsService::StepPhysics(const FrameContext& frame)
 {
+    const double timestep_seconds = kPhysxTimestep.GetSeconds();
+    uint32_t substeps = 0;
+    double dropped_seconds = 0.0;
+
     if (kScene_)
     {
-        while (time_accumulator_ >= kPhysxTimestep)
+        // Bounded, so a hitch can't make the next frame even slower
+        while (time_accumulator_ >= kPhysxTimestep && substeps < max_substeps_)
         {
+            PROFILE_SCOPE("PhysicsService::Substep");
+
             const float timestep_sec =
                 static_cast<float>(kPhysxTimestep.GetSeconds());
 
@@ -536,20 +695,85 @@ void PhysicsService::StepPhysics()
             // Update scene
             kScene_->simulate(timestep_sec);
             kScene_->fetchResults(true);
+            SyncTickPoses();
 
             time_accumulator_ -= kPhysxTimestep;
             tick_count_ += 1;
+            substeps++;
         }
+
+        const double leftover_seconds = time_accumulator_.GetSeconds();
+        double kept_seconds = leftover_seconds;
+
+        if (substep_overflow_ == SubstepOverflow::kDrop)
+        {
+            // Only keep the partial tick, so interpolation stays in phase
+            kept_seconds = std::fmod(leftover_seconds, timestep_seconds);
+        }
+        else
+        {
+            kept_seconds =
+                std::min(leftover_seconds, kMaxDilationBacklogSeconds);
+        }
+
+        dropped_seconds = leftover_seconds - kept_seconds;
+        time_accumulator_.SetSeconds(kept_seconds);
+
+        // Leftover time is rendered by blending the last two tick poses
+        interpolation_alpha_ =
+            static_cast<float>(std::min(kept_seconds / timestep_seconds, 1.0));
     }
 
+    substeps_last_frame_ = substeps;
+    peak_substeps_window_ = std::max(peak_substeps_window_, substeps);
+    dropped_seconds_total_ += dropped_seconds;
+    dropped_seconds_window_ += dropped_seconds;
+    simulated_seconds_window_ += substeps * timestep_seconds;
+
+    PROFILE_COUNTER("Physics substeps", substeps);
+    PROFILE_COUNTER("Physics dropped ms", dropped_seconds * 1000.0);
+
     // Measure physics tick rate
-    const double cur_time = glfwGetTime();
-    if (cur_time - prev_time_ >= 1.0)
+    const double cur_time = frame.elapsed_time.GetSeconds();
+    const double window_seconds = cur_time - rate_window_start_;
+    if (window_seconds >= 1.0)
     {
         tick_rate_ = tick_count_;
         tick_count_ = 0;
-        prev_time_ = cur_time;
+        rate_window_start_ = cur_time;
+
+        peak_substeps_ = peak_substeps_window_;
+        dropped_ms_per_second_ =
+            dropped_seconds_window_ * 1000.0 / window_seconds;
+        time_dilation_ = simulated_seconds_window_ / window_seconds;
+
+        peak_substeps_window_ = 0;
+        dropped_seconds_window_ = 0.0;
+        simulated_seconds_window_ = 0.0;
+    }
+}
+
+void PhysicsService::SyncTickPoses()
+{
+    if (active_scene_)
+    {
+        // Walks the rigid body pools directly instead of a map of actors
+        active_scene_->ForEachComponent<RigidBodyComponent>(
+            [](RigidBodyComponent& body) { body.ApplyTickPose(); });
     }
+
+    for (auto& [vehicle, entity] : vehicles_)
+    {
+        const GlmTransform pose = PxToGlm(
+            vehicle->mPhysXState.physxActor.rigidBody->getGlobalPose());
+        entity->GetComponent<Transform>().SetTickPose(pose.position,
+                                                      pose.orientation);
+    }
+}
+
+float PhysicsService::GetInterpolationAlpha() const
+{
+    return interpolation_alpha_;
 }
 
 const PxVec3& PhysicsService::GetGravity() const
@@ -567,6 +791,16 @@ void PhysicsService::SetPaused(bool boolean)
     display_pause_ = boolean;
 }
 
+void PhysicsService::SetMaxSubsteps(uint32_t max_substeps)
+{
+    max_substeps_ = std::clamp(max_substeps, 1u, kMaxSubstepsLimit);
+}
+
+void PhysicsService::SetSubstepOverflow(SubstepOverflow overflow)
+{
+    substep_overflow_ = overflow;
+}
+
 /* From PxSimulationEventCallback */
 void PhysicsService::onConstraintBreak(PxConstraintInfo* constraints,
                                        PxU32 count)
@@ -588,6 +822,8 @@ void PhysicsService::onContact(const PxContactPairHeader& pair_header,
 
 void PhysicsService::onTrigger(PxTriggerPair* pairs, PxU32 count)
 {
+    // Called from fetchResults on the simulation thread, which can't touch
+    // the scene, so the components hear about it once the tick is over
     for (uint32_t i = 0; i < count; i++)
     {
         PxTriggerPair& pair = pairs[i];
@@ -601,40 +837,14 @@ void PhysicsService::onTrigger(PxTriggerPair* pairs, PxU32 count)
         ASSERT_MSG(other_entity,
                    "PxActor userdata must be a valid entity pointer");
 
-        OnTriggerEvent event_data = {.other = other_entity};
+        const OnPhysicsTriggerEvent event{
+            .trigger = trigger_entity,
+            .other = other_entity,
+            .enter = pair.status == PxPairFlag::eNOTIFY_TOUCH_FOUND};
 
-        bool enter = pair.status == PxPairFlag::eNOTIFY_TOUCH_FOUND;
-
-        if (enter)
+        if (!trigger_queue_.Push(event))
         {
-            for (auto& entry : trigger_entity->GetComponents())
-            {
-                entry.component->OnTriggerEnter(event_data);
-            }
-        }
-        else
-        {
-            for (auto& entry : trigger_entity->GetComponents())
-            {
-                entry.component->OnTriggerExit(event_data);
-            }
-        }
-
-        event_data = {.other = trigger_entity};
-
-        if (enter)
-        {
-            for (auto& entry : other_entity->GetComponents())
-            {
-                entry.component->OnTriggerEnter(event_data);
-            }
-        }
-        else
-        {
-            for (auto& entry : other_entity->GetComponents())
-            {
-                entry.component->OnTriggerExit(event_data);
-            }
+            debug::LogWarn("Trigger queue is full, dropped a trigger event");
         }
     }
 }
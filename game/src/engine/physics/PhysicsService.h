@@ -6,22 +6,41 @@
 
 #include <glm/fwd.hpp>
 #include <map>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "PxPhysicsAPI.h"
 #include "RaycastData.h"
 #include "VehicleCommands.h"
+#include "engine/core/event/ConcurrentEventQueue.h"
 #include "engine/core/math/Timestep.h"
+#include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/gui/OnGuiEvent.h"
+#include "engine/physics/OnPhysicsTriggerEvent.h"
 #include "engine/physics/OnPhysicsUpdateEvent.h"
 #include "engine/scene/Entity.h"
 #include "engine/service/Service.h"
 #include "vehicle2/PxVehicleAPI.h"
 
+class JobCpuDispatcher;
+
+// What to do with simulation time that doesn't fit in a frame's substeps
+enum class SubstepOverflow : uint8_t
+{
+    // Skip it, the world jumps ahead after a hitch
+    kDrop,
+
+    // Catch up over the next frames, the world briefly runs in slow motion
+    kDilate,
+};
+
 class PhysicsService final : public Service,
                              public IEventSubscriber<OnGuiEvent>,
+                             public IEventSubscriber<OnPhysicsTriggerEvent>,
                              public physx::PxSimulationEventCallback
 {
   public:
@@ -29,13 +48,19 @@ class PhysicsService final : public Service,
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
     void OnSceneLoaded(Scene& scene) override;
-    void OnUpdate() override;
+    void OnSceneUnloaded(Scene& scene) override;
+    void OnSceneRestored(Scene& scene) override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     // From IEventSubscriber<OnGuiEvent>
     void OnGui() override;
 
+    // From IEventSubscriber<OnPhysicsTriggerEvent>
+    void OnPhysicsTrigger(const OnPhysicsTriggerEvent& event) override;
+
   private:
     jss::object_ptr<AssetService> asset_service_;
     jss::object_ptr<InputService> input_service_;
@@ -48,24 +73,49 @@ class PhysicsService final : public Service,
     physx::PxPhysics* kPhysics_ = nullptr;
     physx::PxMaterial* kMaterial_ = nullptr;
     physx::PxScene* kScene_ = nullptr;
-    physx::PxDefaultCpuDispatcher* kDispatcher_ = nullptr;
+    JobCpuDispatcher* kDispatcher_ = nullptr;
     physx::PxCooking* cooking_ = nullptr;
     physx::vehicle2::PxVehiclePhysXSimulationContext vehicle_context_;
     std::map<physx::PxActor*, Entity*> actors_;
     std::map<snippetvehicle2::BaseVehicle*, Entity*> vehicles_;
+    jss::object_ptr<Scene> active_scene_;
+
+    // Cooked mesh data by mesh name, filled from worker threads
+    std::unordered_map<std::string, std::vector<physx::PxU8>> cooked_meshes_;
+    std::mutex cooked_meshes_mutex_;
+
+    // Filled by onTrigger during the tick, delivered on the main thread by
+    // the next EventBus flush
+    ConcurrentEventQueue<OnPhysicsTriggerEvent> trigger_queue_{1024};
 
     Timestep time_accumulator_;
+    float interpolation_alpha_ = 1.0f;
+    uint32_t max_substeps_;
+    SubstepOverflow substep_overflow_;
 
     bool show_debug_menu_ = false;
     bool debug_draw_scene_ = false;
     bool debug_draw_raycast_ = false;
     bool display_pause_ = false;
-    double prev_time_;
+    double rate_window_start_;
     int tick_rate_;
     int tick_count_;
 
+    // Catch-up telemetry, the rates are measured over the same second as
+    // the tick rate
+    uint32_t substeps_last_frame_;
+    uint32_t peak_substeps_;
+    uint32_t peak_substeps_window_;
+    double dropped_seconds_total_;
+    double dropped_seconds_window_;
+    double dropped_ms_per_second_;
+    double simulated_seconds_window_;
+    double time_dilation_;
+
     void InitPhysX();
-    void StepPhysics();
+    void StepPhysics(const FrameContext& frame);
+    void SyncTickPoses();
+    std::vector<physx::PxU8> CookTriangleMesh(const std::string& mesh_name);
     void DrawDebugParamWidget(const std::string& name,
                               physx::PxVisualizationParameter::Enum parameter);
 
@@ -76,6 +126,9 @@ class PhysicsService final : public Service,
     void UnregisterVehicle(snippetvehicle2::BaseVehicle* vehicle,
                            Entity* entity);
 
+    // How far the simulation is between the last tick and the next one
+    float GetInterpolationAlpha() const;
+
     /* From PxSimulationEventCallback */
     void onConstraintBreak(physx::PxConstraintInfo* constraints,
                            physx::PxU32 count) override;
@@ -119,6 +172,12 @@ class PhysicsService final : public Service,
         const physx::PxPlane& dimensions);
     physx::PxTriangleMesh* CreateTriangleMesh(const std::string& mesh_name);
 
+    /**
+     * Cooks a mesh ahead of time so CreateTriangleMesh only has to build it.
+     * Safe to call from worker threads
+     */
+    void PrepareTriangleMesh(const std::string& mesh_name);
+
     physx::PxRigidDynamic* CreateRigidDynamic(const glm::vec3& position,
                                               const glm::quat& orientation);
     physx::PxRigidStatic* CreateRigidStatic(const glm::vec3& position,
@@ -143,4 +202,7 @@ class PhysicsService final : public Service,
 
     bool GetPaused();
     void SetPaused(bool boolean);
+
+    void SetMaxSubsteps(uint32_t max_substeps);
+    void SetSubstepOverflow(SubstepOverflow overflow);
 };
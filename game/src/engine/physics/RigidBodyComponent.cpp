@@ -19,10 +19,9 @@ void RigidBodyComponent::OnInit(const ServiceProvider& service_provider)
     physics_service_ = &service_provider.GetService<PhysicsService>();
     transform_ = &GetEntity().GetComponent<Transform>();
 
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
-
     dynamic_ = physics_service_->CreateRigidDynamic(
-        transform_->GetPosition(), transform_->GetOrientation());
+        transform_->GetWorldPosition(), transform_->GetWorldOrientation());
+    synced_version_ = transform_->GetWorldVersion();
     dynamic_->userData = &GetEntity();
     dynamic_->setActorFlag(physx::PxActorFlag::eVISUALIZATION, true);
 
@@ -31,14 +30,6 @@ void RigidBodyComponent::OnInit(const ServiceProvider& service_provider)
     physics_service_->RegisterActor(dynamic_, &GetEntity());
 }
 
-void RigidBodyComponent::OnUpdate(const Timestep& delta_time)
-{
-    const PxTransform pose = dynamic_->getGlobalPose();
-    const GlmTransform transform = PxToGlm(pose);
-    transform_->SetPosition(transform.position);
-    transform_->SetOrientation(transform.orientation);
-}
-
 void RigidBodyComponent::OnDestroy()
 {
     physics_service_->UnregisterActor(dynamic_, &GetEntity());
@@ -62,7 +53,51 @@ void RigidBodyComponent::SetGravityEnabled(bool enabled)
 
 void RigidBodyComponent::SyncTransform()
 {
-    PxTransform pose = CreatePxTransform(transform_->GetPosition(),
-                                         transform_->GetOrientation());
+    PxTransform pose = CreatePxTransform(transform_->GetWorldPosition(),
+                                         transform_->GetWorldOrientation());
     dynamic_->setGlobalPose(pose);
+    synced_version_ = transform_->GetWorldVersion();
+}
+
+void RigidBodyComponent::SyncTransformIfMoved()
+{
+    if (transform_->GetWorldVersion() != synced_version_)
+    {
+        SyncTransform();
+    }
+}
+
+void RigidBodyComponent::ApplyTickPose()
+{
+    if (!transform_synced_)
+    {
+        return;
+    }
+
+    const GlmTransform pose = PxToGlm(dynamic_->getGlobalPose());
+    transform_->SetTickPose(pose.position, pose.orientation);
+}
+
+void RigidBodyComponent::SetTransformSynced(bool synced)
+{
+    transform_synced_ = synced;
+}
+
+RigidBodyComponent::SnapshotState RigidBodyComponent::SaveSnapshot() const
+{
+    const GlmTransform pose = PxToGlm(dynamic_->getGlobalPose());
+
+    return SnapshotState{
+        .position = pose.position,
+        .orientation = pose.orientation,
+        .linear_velocity = PxToGlm(dynamic_->getLinearVelocity()),
+        .angular_velocity = PxToGlm(dynamic_->getAngularVelocity())};
+}
+
+void RigidBodyComponent::RestoreSnapshot(const SnapshotState& state)
+{
+    dynamic_->setGlobalPose(
+        CreatePxTransform(state.position, state.orientation));
+    dynamic_->setLinearVelocity(GlmToPx(state.linear_velocity));
+    dynamic_->setAngularVelocity(GlmToPx(state.angular_velocity));
 }
\ No newline at end of file
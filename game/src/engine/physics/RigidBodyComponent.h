@@ -1,24 +1,45 @@
 #pragma once
 
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
 #include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdPhysx.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 
-class RigidBodyComponent : public Component,
-                           public IEventSubscriber<OnUpdateEvent>
+class RigidBodyComponent : public Component
 {
   public:
+    struct SnapshotState
+    {
+        glm::vec3 position;
+        glm::quat orientation;
+        glm::vec3 linear_velocity;
+        glm::vec3 angular_velocity;
+    };
+
     void SetMass(float mass);
     float GetMass() const;
     void SetGravityEnabled(bool enabled);
 
     void SyncTransform();
 
+    // Skips the sync if the transform hasn't moved since the last one
+    void SyncTransformIfMoved();
+
+    // Copies the actor's pose into the transform, PhysicsService calls this
+    // after every tick
+    void ApplyTickPose();
+
+    // Off for bodies driven by their transform instead, like hitboxes
+    void SetTransformSynced(bool synced);
+
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     // From Component
     virtual void OnInit(const ServiceProvider& service_provider) override;
-    virtual void OnUpdate(const Timestep& delta_time) override;
     virtual void OnDestroy() override;
 
   protected:
@@ -26,4 +47,6 @@ class RigidBodyComponent : public Component,
     jss::object_ptr<PhysicsService> physics_service_;
 
     physx::PxRigidDynamic* dynamic_;
+    bool transform_synced_ = true;
+    uint32_t synced_version_ = 0;
 };
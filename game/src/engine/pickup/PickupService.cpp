@@ -9,6 +9,8 @@
 #include <iostream>
 
 #include "engine/core/debug/Log.h"
+#include "engine/scene/Scene.h"
+#include "game/components/Pickups/Pickup.h"
 #include "game/components/state/PlayerState.h"
 
 using rapidjson::Document;
@@ -42,8 +44,16 @@ void PickupService::OnStart(ServiceProvider& service_provider)
 {
 }
 
-void PickupService::OnUpdate()
+void PickupService::OnUpdate(const FrameContext& frame)
 {
+    if (!active_scene_)
+    {
+        return;
+    }
+
+    // One pass over the pickup pools, instead of an event per pickup
+    active_scene_->ForEachComponent<Pickup>(
+        [&frame](Pickup& pickup) { pickup.Spin(frame.delta_time); });
 }
 
 void PickupService::OnCleanup()
@@ -53,6 +63,12 @@ void PickupService::OnCleanup()
 void PickupService::OnSceneLoaded(Scene& scene)
 {
     active_powerup_ = "";
+    active_scene_ = &scene;
+}
+
+void PickupService::OnSceneUnloaded(Scene& scene)
+{
+    active_scene_ = nullptr;
 }
 
 std::string_view PickupService::GetName() const
@@ -60,6 +76,17 @@ std::string_view PickupService::GetName() const
     return "Powerup Service";
 }
 
+ServiceAccess PickupService::GetAccess() const
+{
+    // Only spins the pickups. Their respawn timers live on the Pickup
+    // components and held powerups tick from OnUpdateEvent. Walking the pools
+    // still reads the scene, but the rotations only touch pickup transforms
+    return ServiceAccess{.reads = service_access::kScene,
+                         .writes = service_access::kPickups,
+                         .main_thread = false,
+                         .phase = UpdatePhase::kSimulation};
+}
+
 // From OnUpdateEvent
 void PickupService::OnUpdate(const Timestep& delta_time)
 {
@@ -10,6 +10,8 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include <object_ptr.hpp>
+
 #include "engine/fwd/FwdServices.h"
 #include "engine/scene/OnUpdateEvent.h"
 #include "engine/service/Service.h"
@@ -57,11 +59,13 @@ class PickupService final : public Service,
 
     // From Service
     void OnInit() override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     void OnStart(ServiceProvider& service_provider);
     void OnSceneLoaded(Scene& scene) override;
+    void OnSceneUnloaded(Scene& scene) override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     // From OnUpdateEvent
     void OnUpdate(const Timestep& delta_time);
@@ -132,4 +136,6 @@ class PickupService final : public Service,
     std::unordered_set<Entity*> not_slow_entities_;
 
     std::string active_powerup_;
+
+    jss::object_ptr<Scene> active_scene_;
 };
\ No newline at end of file
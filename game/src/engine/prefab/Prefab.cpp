@@ -0,0 +1,288 @@
+#include "engine/prefab/Prefab.h"
+
+#include "engine/core/debug/Log.h"
+
+using std::byte;
+using std::span;
+using std::string;
+using std::string_view;
+using std::vector;
+
+// Bounds checked reads while validating a blob
+class BlobCursor
+{
+  public:
+    BlobCursor(const vector<byte>& blob) : blob_(blob), offset_(0)
+    {
+    }
+
+    bool ReadU32(uint32_t& out)
+    {
+        if (offset_ + sizeof(uint32_t) > blob_.size())
+        {
+            return false;
+        }
+
+        std::memcpy(&out, blob_.data() + offset_, sizeof(uint32_t));
+        offset_ += sizeof(uint32_t);
+        return true;
+    }
+
+    bool Skip(size_t size)
+    {
+        if (size > blob_.size() - offset_)
+        {
+            return false;
+        }
+
+        offset_ += size;
+        return true;
+    }
+
+    size_t GetOffset() const
+    {
+        return offset_;
+    }
+
+  private:
+    const vector<byte>& blob_;
+    size_t offset_;
+};
+
+uint32_t PrefabStrings::Add(string_view value)
+{
+    auto [iter, inserted] = ids_.try_emplace(
+        string(value), static_cast<uint32_t>(strings_.size()));
+
+    if (inserted)
+    {
+        strings_.push_back(iter->first);
+    }
+
+    return iter->second;
+}
+
+const vector<string>& PrefabStrings::GetStrings() const
+{
+    return strings_;
+}
+
+PrefabWriter::PrefabWriter(vector<byte>& bytes, PrefabStrings& strings)
+    : bytes_(bytes),
+      strings_(strings),
+      entity_index_(0),
+      entity_count_(0)
+{
+}
+
+void PrefabWriter::WriteString(string_view value)
+{
+    Write<uint32_t>(strings_.Add(value));
+}
+
+void PrefabWriter::WriteBytes(span<const byte> bytes)
+{
+    bytes_.insert(bytes_.end(), bytes.begin(), bytes.end());
+}
+
+void PrefabWriter::BeginEntity(uint32_t index, uint32_t count)
+{
+    entity_index_ = index;
+    entity_count_ = count;
+}
+
+uint32_t PrefabWriter::GetEntityIndex() const
+{
+    return entity_index_;
+}
+
+bool PrefabWriter::CheckEntityIndex(uint32_t index) const
+{
+    if (index >= entity_count_)
+    {
+        debug::LogError("Entity index {} is out of range, prefab has {}",
+                        index, entity_count_);
+        return false;
+    }
+
+    return true;
+}
+
+PrefabReader::PrefabReader(const Prefab& prefab, span<const byte> bytes)
+    : prefab_(prefab),
+      bytes_(bytes),
+      offset_(0)
+{
+}
+
+string_view PrefabReader::ReadString()
+{
+    return prefab_.GetString(Read<uint32_t>());
+}
+
+span<const byte> PrefabReader::ReadBytes(size_t size)
+{
+    ASSERT_MSG(offset_ + size <= bytes_.size(),
+               "Read past the end of prefab data");
+
+    span<const byte> result = bytes_.subspan(offset_, size);
+    offset_ += size;
+    return result;
+}
+
+bool PrefabReader::IsAtEnd() const
+{
+    return offset_ == bytes_.size();
+}
+
+Prefab::Prefab(const string& name, vector<byte> blob)
+    : name_(name),
+      blob_(std::move(blob)),
+      valid_(false),
+      strings_{},
+      component_types_{},
+      entity_names_{},
+      component_count_(0),
+      component_data_offset_(0)
+{
+    valid_ = Parse();
+
+    if (!valid_)
+    {
+        debug::LogError("Prefab '{}' is not a valid compiled prefab", name_);
+    }
+}
+
+bool Prefab::IsValid() const
+{
+    return valid_;
+}
+
+const string& Prefab::GetName() const
+{
+    return name_;
+}
+
+string_view Prefab::GetString(uint32_t id) const
+{
+    ASSERT_MSG(id < strings_.size(), "Invalid prefab string id");
+    return strings_[id];
+}
+
+span<const string_view> Prefab::GetComponentTypes() const
+{
+    return component_types_;
+}
+
+span<const string_view> Prefab::GetEntityNames() const
+{
+    return entity_names_;
+}
+
+uint32_t Prefab::GetComponentCount() const
+{
+    return component_count_;
+}
+
+span<const byte> Prefab::GetComponentData() const
+{
+    return span<const byte>(blob_).subspan(component_data_offset_);
+}
+
+size_t Prefab::GetSize() const
+{
+    return blob_.size();
+}
+
+bool Prefab::Parse()
+{
+    if (blob_.size() < sizeof(PrefabHeader))
+    {
+        return false;
+    }
+
+    PrefabHeader header;
+    std::memcpy(&header, blob_.data(), sizeof(PrefabHeader));
+
+    if (header.magic != PrefabHeader::kMagic ||
+        header.version != PrefabHeader::kVersion)
+    {
+        return false;
+    }
+
+    BlobCursor cursor(blob_);
+    cursor.Skip(sizeof(PrefabHeader));
+
+    const char* chars = reinterpret_cast<const char*>(blob_.data());
+    strings_.reserve(header.string_count);
+
+    for (uint32_t i = 0; i < header.string_count; i++)
+    {
+        uint32_t length;
+        if (!cursor.ReadU32(length))
+        {
+            return false;
+        }
+
+        const size_t offset = cursor.GetOffset();
+        if (!cursor.Skip(length))
+        {
+            return false;
+        }
+
+        strings_.emplace_back(chars + offset, length);
+    }
+
+    // Component types and entity names are both string ids
+    auto read_names = [&](uint32_t count, vector<string_view>& out)
+    {
+        out.reserve(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t id;
+            if (!cursor.ReadU32(id) || id >= strings_.size())
+            {
+                return false;
+            }
+
+            out.push_back(strings_[id]);
+        }
+
+        return true;
+    };
+
+    if (!read_names(header.type_count, component_types_) ||
+        !read_names(header.entity_count, entity_names_))
+    {
+        return false;
+    }
+
+    component_data_offset_ = cursor.GetOffset();
+
+    // Walk every component once, so instantiating never has to check bounds
+    for (uint32_t i = 0; i < header.entity_count; i++)
+    {
+        uint32_t count;
+        if (!cursor.ReadU32(count))
+        {
+            return false;
+        }
+
+        for (uint32_t j = 0; j < count; j++)
+        {
+            uint32_t type;
+            uint32_t size;
+            if (!cursor.ReadU32(type) || !cursor.ReadU32(size) ||
+                type >= header.type_count || !cursor.Skip(size))
+            {
+                return false;
+            }
+        }
+
+        component_count_ += count;
+    }
+
+    return component_count_ == header.component_count &&
+           cursor.GetOffset() == blob_.size();
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/debug/Assert.h"
+
+/**
+ * Compiled prefab layout, every field is a uint32_t unless noted:
+ *
+ *   PrefabHeader
+ *   strings          string_count x (length, chars)
+ *   component types  type_count x string id
+ *   entity names     entity_count x string id
+ *   components       per entity: count, then count x (type, size, data)
+ *
+ * Component data is whatever that type's compile function wrote, and is read
+ * back in the same order by its instantiate function
+ */
+struct PrefabHeader
+{
+    static constexpr uint32_t kMagic = 0x42465250;  // "PRFB"
+    static constexpr uint32_t kVersion = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t string_count;
+    uint32_t type_count;
+    uint32_t entity_count;
+    uint32_t component_count;
+};
+
+// Deduplicated strings referenced by id from component data
+class PrefabStrings
+{
+  public:
+    uint32_t Add(std::string_view value);
+    const std::vector<std::string>& GetStrings() const;
+
+  private:
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> ids_;
+};
+
+class PrefabWriter
+{
+  public:
+    PrefabWriter(std::vector<std::byte>& bytes, PrefabStrings& strings);
+
+    template <class T>
+        requires std::is_trivially_copyable_v<T>
+    void Write(const T& value)
+    {
+        const size_t offset = bytes_.size();
+        bytes_.resize(offset + sizeof(T));
+        std::memcpy(bytes_.data() + offset, &value, sizeof(T));
+    }
+
+    void WriteString(std::string_view value);
+    void WriteBytes(std::span<const std::byte> bytes);
+
+    // Which of the prefab's entities the components being written belong to
+    void BeginEntity(uint32_t index, uint32_t count);
+    uint32_t GetEntityIndex() const;
+
+    // Logs an error if a component refers to an entity outside the prefab
+    bool CheckEntityIndex(uint32_t index) const;
+
+  private:
+    std::vector<std::byte>& bytes_;
+    PrefabStrings& strings_;
+    uint32_t entity_index_;
+    uint32_t entity_count_;
+};
+
+class Prefab;
+
+class PrefabReader
+{
+  public:
+    PrefabReader(const Prefab& prefab, std::span<const std::byte> bytes);
+
+    template <class T>
+        requires std::is_trivially_copyable_v<T>
+    T Read()
+    {
+        ASSERT_MSG(offset_ + sizeof(T) <= bytes_.size(),
+                   "Read past the end of prefab data");
+
+        T value;
+        std::memcpy(&value, bytes_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return value;
+    }
+
+    std::string_view ReadString();
+    std::span<const std::byte> ReadBytes(size_t size);
+    bool IsAtEnd() const;
+
+  private:
+    const Prefab& prefab_;
+    std::span<const std::byte> bytes_;
+    size_t offset_;
+};
+
+/**
+ * A prefab compiled into a single blob. Creating one checks the layout once,
+ * after that instantiating it is a straight walk over the bytes
+ */
+class Prefab
+{
+  public:
+    Prefab(const std::string& name, std::vector<std::byte> blob);
+
+    Prefab(const Prefab&) = delete;
+    Prefab& operator=(const Prefab&) = delete;
+    Prefab(Prefab&&) = default;
+    Prefab& operator=(Prefab&&) = default;
+
+    // False if the blob was truncated or built for another format version
+    bool IsValid() const;
+
+    const std::string& GetName() const;
+    std::string_view GetString(uint32_t id) const;
+    std::span<const std::string_view> GetComponentTypes() const;
+    std::span<const std::string_view> GetEntityNames() const;
+    uint32_t GetComponentCount() const;
+
+    // Every entity's component list, in entity order
+    std::span<const std::byte> GetComponentData() const;
+    size_t GetSize() const;
+
+  private:
+    std::string name_;
+    std::vector<std::byte> blob_;
+    bool valid_;
+
+    // Point into blob_, which never moves once constructed
+    std::vector<std::string_view> strings_;
+    std::vector<std::string_view> component_types_;
+    std::vector<std::string_view> entity_names_;
+    uint32_t component_count_;
+    size_t component_data_offset_;
+
+    bool Parse();
+};
@@ -0,0 +1,667 @@
+#include "engine/prefab/PrefabService.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/istreamwrapper.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "engine/App.h"
+#include "engine/asset/AssetService.h"
+#include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
+#include "engine/core/json/deserialize_utils.h"
+#include "engine/physics/BoxTrigger.h"
+#include "engine/physics/MeshStaticBody.h"
+#include "engine/render/Camera.h"
+#include "engine/render/MeshRenderer.h"
+#include "engine/scene/Transform.h"
+
+using glm::vec3;
+using rapidjson::Document;
+using rapidjson::IStreamWrapper;
+using rapidjson::Value;
+using std::byte;
+using std::string;
+using std::string_view;
+using std::vector;
+
+static constexpr const char* kPrefabDirectory = "resources/prefabs";
+static constexpr const char* kPrefabExtension = ".jsonc";
+
+// Missing members keep their default, but one that's there must be valid
+static bool ReadVec3(const Value& node, const string& name, vec3& out_val)
+{
+    return !node.HasMember(name) || json::GetVec3(node, name, out_val);
+}
+
+static bool ReadFloat(const Value& node, const string& name, float& out_val)
+{
+    Value::ConstMemberIterator iter = node.FindMember(name);
+
+    if (iter == node.MemberEnd())
+    {
+        return true;
+    }
+
+    if (!iter->value.IsNumber())
+    {
+        return false;
+    }
+
+    out_val = iter->value.GetFloat();
+    return true;
+}
+
+/* ----- Transform ----- */
+
+struct TransformData
+{
+    vec3 position;
+    vec3 orientation_euler_degrees;
+    vec3 scale;
+
+    // Index of the parent entity within the same prefab, or -1
+    int32_t parent;
+};
+
+static bool CompileTransform(const Value& node, PrefabWriter& writer)
+{
+    TransformData data{.position = vec3(0.0f),
+                       .orientation_euler_degrees = vec3(0.0f),
+                       .scale = vec3(1.0f),
+                       .parent = -1};
+
+    bool status = true;
+    status &= ReadVec3(node, "position", data.position);
+    status &= ReadVec3(node, "orientation_euler_degrees",
+                       data.orientation_euler_degrees);
+    status &= ReadVec3(node, "scale", data.scale);
+
+    Value::ConstMemberIterator iter = node.FindMember("parent");
+
+    if (iter != node.MemberEnd())
+    {
+        if (!iter->value.IsUint())
+        {
+            return false;
+        }
+
+        const uint32_t parent = iter->value.GetUint();
+
+        if (!writer.CheckEntityIndex(parent))
+        {
+            return false;
+        }
+
+        // Instantiated in order, so the parent's Transform has to exist first
+        if (parent >= writer.GetEntityIndex())
+        {
+            debug::LogError("Parent entity {} must come before its child {}",
+                            parent, writer.GetEntityIndex());
+            return false;
+        }
+
+        data.parent = static_cast<int32_t>(parent);
+    }
+
+    writer.Write(data);
+    return status;
+}
+
+static void InstantiateTransform(Entity& entity, PrefabReader& reader,
+                                 const PrefabContext& context)
+{
+    const auto data = reader.Read<TransformData>();
+
+    auto& transform = entity.AddComponent<Transform>();
+    transform.RotateEulerDegrees(data.orientation_euler_degrees);
+    transform.SetScale(data.scale);
+
+    // Children are authored relative to their parent, which already moved
+    if (data.parent >= 0)
+    {
+        Entity& parent = context.GetEntity(data.parent);
+        ASSERT_MSG(parent.HasComponent<Transform>(),
+                   "Parent entity must come before its children in a prefab");
+
+        transform.SetPosition(data.position);
+        transform.SetParent(&parent.GetComponent<Transform>());
+        return;
+    }
+
+    transform.SetPosition(context.spawn.position + data.position);
+    transform.RotateEulerDegrees(context.spawn.orientation_euler_degrees);
+}
+
+/* ----- MeshRenderer ----- */
+
+struct MaterialData
+{
+    vec3 albedo_color;
+    vec3 specular;
+    float shininess;
+};
+
+static bool CompileMeshRenderer(const Value& node, PrefabWriter& writer)
+{
+    Value::ConstMemberIterator iter = node.FindMember("meshes");
+
+    if (iter == node.MemberEnd() || !iter->value.IsArray())
+    {
+        return false;
+    }
+
+    auto meshes = iter->value.GetArray();
+    writer.Write<uint32_t>(meshes.Size());
+
+    for (const Value& mesh_node : meshes)
+    {
+        string mesh;
+        string texture = "";
+        MaterialData material{.albedo_color = vec3(1.0f),
+                              .specular = vec3(1.0f),
+                              .shininess = 64.0f};
+
+        if (!mesh_node.IsObject() || !json::GetString(mesh_node, "mesh", mesh))
+        {
+            return false;
+        }
+
+        bool status = true;
+        json::GetString(mesh_node, "texture", texture);
+        status &= ReadVec3(mesh_node, "albedo_color", material.albedo_color);
+        status &= ReadVec3(mesh_node, "specular", material.specular);
+        status &= ReadFloat(mesh_node, "shininess", material.shininess);
+
+        if (!status)
+        {
+            return false;
+        }
+
+        writer.WriteString(mesh);
+        writer.WriteString(texture);
+        writer.Write(material);
+    }
+
+    return true;
+}
+
+static void InstantiateMeshRenderer(Entity& entity, PrefabReader& reader,
+                                    const PrefabContext& context)
+{
+    auto& mesh_renderer = entity.AddComponent<MeshRenderer>();
+
+    // Textures aren't loaded when headless
+    if (context.headless)
+    {
+        return;
+    }
+
+    AssetService& asset_service =
+        context.service_provider.GetService<AssetService>();
+
+    const auto count = reader.Read<uint32_t>();
+    vector<RenderableMesh> meshes;
+    meshes.reserve(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const string mesh(reader.ReadString());
+        const string texture(reader.ReadString());
+        const auto material = reader.Read<MaterialData>();
+
+        meshes.push_back(RenderableMesh{
+            .mesh = &asset_service.GetMesh(mesh),
+            .material_properties = MaterialProperties{
+                .albedo_texture = texture.empty()
+                                      ? nullptr
+                                      : &asset_service.GetTexture(texture),
+                .albedo_color = material.albedo_color,
+                .specular = material.specular,
+                .shininess = material.shininess,
+            }});
+    }
+
+    mesh_renderer.SetMeshes(meshes);
+}
+
+/* ----- Camera ----- */
+
+static bool CompileCamera(const Value& node, PrefabWriter& writer)
+{
+    string type = "normal";
+    json::GetString(node, "camera_type", type);
+
+    if (type == "normal")
+    {
+        writer.Write(CameraType::kNormal);
+    }
+    else if (type == "disabled")
+    {
+        writer.Write(CameraType::kDisabled);
+    }
+    else if (type == "debug")
+    {
+        writer.Write(CameraType::kDebug);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static void InstantiateCamera(Entity& entity, PrefabReader& reader,
+                              const PrefabContext& context)
+{
+    auto& camera = entity.AddComponent<Camera>();
+    camera.SetType(reader.Read<CameraType>());
+}
+
+/* ----- MeshStaticBody ----- */
+
+static bool CompileMeshStaticBody(const Value& node, PrefabWriter& writer)
+{
+    string mesh;
+    float scale = 1.0f;
+
+    if (!json::GetString(node, "mesh", mesh) ||
+        !ReadFloat(node, "scale", scale))
+    {
+        return false;
+    }
+
+    writer.WriteString(mesh);
+    writer.Write(scale);
+    return true;
+}
+
+static void InstantiateMeshStaticBody(Entity& entity, PrefabReader& reader,
+                                      const PrefabContext& context)
+{
+    const string mesh(reader.ReadString());
+    const auto scale = reader.Read<float>();
+
+    auto& static_body = entity.AddComponent<MeshStaticBody>();
+    static_body.SetMesh(mesh, scale);
+}
+
+/* ----- BoxTrigger ----- */
+
+static bool CompileBoxTrigger(const Value& node, PrefabWriter& writer)
+{
+    vec3 size(0.0f);
+    const bool has_size = json::GetVec3(node, "size", size);
+
+    if (!has_size && node.HasMember("size"))
+    {
+        return false;
+    }
+
+    writer.Write(has_size);
+    writer.Write(size);
+    return true;
+}
+
+static void InstantiateBoxTrigger(Entity& entity, PrefabReader& reader,
+                                  const PrefabContext& context)
+{
+    const auto has_size = reader.Read<bool>();
+    const auto size = reader.Read<vec3>();
+
+    auto& trigger = entity.AddComponent<BoxTrigger>();
+
+    if (has_size)
+    {
+        trigger.SetSize(size);
+    }
+}
+
+/* ----- PrefabContext ----- */
+
+Entity& PrefabContext::GetEntity(uint32_t index) const
+{
+    ASSERT_MSG(index < entities.size(), "Prefab entity index out of range");
+    return *entities[index];
+}
+
+/* ----- PrefabService ----- */
+
+PrefabService::PrefabService()
+    : service_provider_(nullptr),
+      loaders_{},
+      prefabs_{}
+{
+}
+
+void PrefabService::RegisterComponent(string_view type,
+                                      CompileFunction compile,
+                                      InstantiateFunction instantiate)
+{
+    auto [iter, inserted] = loaders_.try_emplace(
+        string(type),
+        ComponentLoader{.compile = compile, .instantiate = instantiate});
+
+    ASSERT_MSG(inserted, "Prefab component type registered twice");
+}
+
+void PrefabService::LoadPrefabs()
+{
+    PROFILE_SCOPE("PrefabService::LoadPrefabs");
+
+    vector<std::filesystem::path> paths;
+
+    for (auto& entry : std::filesystem::directory_iterator(kPrefabDirectory))
+    {
+        if (entry.path().extension() == kPrefabExtension)
+        {
+            paths.push_back(entry.path());
+        }
+    }
+
+    // Same load order on every platform
+    std::sort(paths.begin(), paths.end());
+
+    for (auto& path : paths)
+    {
+        LoadPrefabFile(path.string());
+    }
+
+    debug::LogInfo("Loaded {} prefabs", prefabs_.size());
+}
+
+bool PrefabService::LoadPrefabFile(const string& path)
+{
+    std::ifstream file_stream(path);
+
+    if (!file_stream.is_open())
+    {
+        debug::LogError("Failed to open prefab file: {}", path);
+        return false;
+    }
+
+    IStreamWrapper stream(file_stream);
+    Document doc;
+    doc.ParseStream(stream);
+
+    if (doc.HasParseError())
+    {
+        debug::LogError("JSON parsing error in prefab {}: {}", path,
+                        doc.GetParseError());
+        return false;
+    }
+
+    vector<byte> blob;
+    if (!CompilePrefab(doc, blob))
+    {
+        debug::LogError("Failed to compile prefab: {}", path);
+        return false;
+    }
+
+    const string name = std::filesystem::path(path).stem().string();
+    Prefab prefab(name, std::move(blob));
+
+    if (!prefab.IsValid())
+    {
+        return false;
+    }
+
+    // Look up every loader now, so instantiating never does
+    vector<InstantiateFunction> instantiate;
+    instantiate.reserve(prefab.GetComponentTypes().size());
+
+    for (string_view type : prefab.GetComponentTypes())
+    {
+        instantiate.push_back(loaders_.at(string(type)).instantiate);
+    }
+
+    prefabs_.insert_or_assign(
+        name, LoadedPrefab{.prefab = std::move(prefab),
+                           .instantiate = std::move(instantiate)});
+    return true;
+}
+
+bool PrefabService::CompilePrefab(const Value& node, vector<byte>& out)
+{
+    if (!node.IsObject())
+    {
+        debug::LogError("Prefab must be an object");
+        return false;
+    }
+
+    Value::ConstMemberIterator entities_iter = node.FindMember("entities");
+
+    if (entities_iter == node.MemberEnd() || !entities_iter->value.IsArray() ||
+        entities_iter->value.Empty())
+    {
+        debug::LogError("Prefab must have a non-empty 'entities' array");
+        return false;
+    }
+
+    PrefabStrings strings;
+    vector<uint32_t> type_names;
+    std::unordered_map<string, uint32_t> type_indices;
+    vector<uint32_t> entity_names;
+
+    vector<byte> components;
+    PrefabWriter component_writer(components, strings);
+    uint32_t component_count = 0;
+
+    const uint32_t entity_count = entities_iter->value.Size();
+
+    for (const Value& entity_node : entities_iter->value.GetArray())
+    {
+        component_writer.BeginEntity(
+            static_cast<uint32_t>(entity_names.size()), entity_count);
+
+        if (!entity_node.IsObject())
+        {
+            debug::LogError("Prefab entities must be objects");
+            return false;
+        }
+
+        string entity_name = "Entity";
+        json::GetString(entity_node, "name", entity_name);
+        entity_names.push_back(strings.Add(entity_name));
+
+        Value::ConstMemberIterator iter = entity_node.FindMember("components");
+
+        if (iter == entity_node.MemberEnd() || !iter->value.IsArray())
+        {
+            debug::LogError("Prefab entity '{}' has no 'components' array",
+                            entity_name);
+            return false;
+        }
+
+        component_writer.Write<uint32_t>(iter->value.Size());
+
+        for (const Value& component_node : iter->value.GetArray())
+        {
+            string type;
+            if (!component_node.IsObject() ||
+                !json::GetString(component_node, "type", type))
+            {
+                debug::LogError("Prefab component in '{}' has no 'type'",
+                                entity_name);
+                return false;
+            }
+
+            auto loader = loaders_.find(type);
+            if (loader == loaders_.end())
+            {
+                debug::LogError("Unknown prefab component type: {}", type);
+                return false;
+            }
+
+            auto [type_iter, inserted] = type_indices.try_emplace(
+                type, static_cast<uint32_t>(type_names.size()));
+            if (inserted)
+            {
+                type_names.push_back(strings.Add(type));
+            }
+
+            component_writer.Write<uint32_t>(type_iter->second);
+
+            // Size is patched in once the component has written its data
+            const size_t size_offset = components.size();
+            component_writer.Write<uint32_t>(0);
+            const size_t data_offset = components.size();
+
+            if (loader->second.compile &&
+                !loader->second.compile(component_node, component_writer))
+            {
+                debug::LogError("Invalid {} component in prefab entity '{}'",
+                                type, entity_name);
+                return false;
+            }
+
+            const auto size =
+                static_cast<uint32_t>(components.size() - data_offset);
+            std::memcpy(components.data() + size_offset, &size, sizeof(size));
+
+            component_count++;
+        }
+    }
+
+    const vector<string>& string_table = strings.GetStrings();
+
+    out.clear();
+    PrefabWriter writer(out, strings);
+
+    writer.Write(PrefabHeader{
+        .magic = PrefabHeader::kMagic,
+        .version = PrefabHeader::kVersion,
+        .string_count = static_cast<uint32_t>(string_table.size()),
+        .type_count = static_cast<uint32_t>(type_names.size()),
+        .entity_count = static_cast<uint32_t>(entity_names.size()),
+        .component_count = component_count,
+    });
+
+    for (const string& value : string_table)
+    {
+        writer.Write<uint32_t>(static_cast<uint32_t>(value.size()));
+        writer.WriteBytes(std::as_bytes(std::span(value)));
+    }
+
+    for (uint32_t id : type_names)
+    {
+        writer.Write(id);
+    }
+
+    for (uint32_t id : entity_names)
+    {
+        writer.Write(id);
+    }
+
+    writer.WriteBytes(components);
+    return true;
+}
+
+bool PrefabService::HasPrefab(const string& name) const
+{
+    return prefabs_.contains(name);
+}
+
+const Prefab& PrefabService::GetPrefab(const string& name) const
+{
+    auto iter = prefabs_.find(name);
+    ASSERT_MSG(iter != prefabs_.end(), "Prefab must be loaded");
+    return iter->second.prefab;
+}
+
+Entity& PrefabService::Instantiate(Scene& scene, const string& name,
+                                   const PrefabSpawn& spawn)
+{
+    auto iter = prefabs_.find(name);
+    ASSERT_MSG(iter != prefabs_.end(), "Prefab must be loaded");
+
+    const Prefab& prefab = iter->second.prefab;
+    const auto& instantiate = iter->second.instantiate;
+    const auto entity_names = prefab.GetEntityNames();
+
+    // All entities exist before any component is added, so components can
+    // refer to entities further down the prefab
+    scene.ReserveEntities(entity_names.size());
+
+    vector<Entity*> entities;
+    entities.reserve(entity_names.size());
+
+    for (string_view entity_name : entity_names)
+    {
+        entities.push_back(&scene.AddEntity(string(entity_name)));
+    }
+
+    if (!spawn.name.empty())
+    {
+        entities.front()->SetName(spawn.name);
+    }
+
+    const PrefabContext context{.service_provider = *service_provider_,
+                                .spawn = spawn,
+                                .headless = GetApp().IsHeadless(),
+                                .entities = entities};
+
+    // Layout was checked when the prefab was loaded
+    PrefabReader reader(prefab, prefab.GetComponentData());
+
+    for (Entity* entity : entities)
+    {
+        const auto count = reader.Read<uint32_t>();
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const auto type = reader.Read<uint32_t>();
+            const auto size = reader.Read<uint32_t>();
+
+            PrefabReader component_reader(prefab, reader.ReadBytes(size));
+            instantiate[type](*entity, component_reader, context);
+        }
+    }
+
+    return *entities.front();
+}
+
+void PrefabService::OnInit()
+{
+    RegisterEngineComponents();
+}
+
+void PrefabService::OnStart(ServiceProvider& service_provider)
+{
+    service_provider_ = &service_provider;
+}
+
+void PrefabService::OnUpdate(const FrameContext& frame)
+{
+}
+
+void PrefabService::OnCleanup()
+{
+}
+
+string_view PrefabService::GetName() const
+{
+    return "PrefabService";
+}
+
+ServiceAccess PrefabService::GetAccess() const
+{
+    return ServiceAccess{.reads = service_access::kNone,
+                         .writes = service_access::kNone,
+                         .main_thread = false};
+}
+
+void PrefabService::RegisterEngineComponents()
+{
+    RegisterComponent("Transform", &CompileTransform, &InstantiateTransform);
+    RegisterComponent("MeshRenderer", &CompileMeshRenderer,
+                      &InstantiateMeshRenderer);
+    RegisterComponent("Camera", &CompileCamera, &InstantiateCamera);
+    RegisterComponent("MeshStaticBody", &CompileMeshStaticBody,
+                      &InstantiateMeshStaticBody);
+    RegisterComponent("BoxTrigger", &CompileBoxTrigger,
+                      &InstantiateBoxTrigger);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <rapidjson/fwd.h>
+
+#include <glm/glm.hpp>
+#include <object_ptr.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/prefab/Prefab.h"
+#include "engine/scene/Scene.h"
+#include "engine/service/Service.h"
+
+// Where and as what a prefab is placed in the scene
+struct PrefabSpawn
+{
+    // Replaces the name of the prefab's first entity, if set
+    std::string name = "";
+
+    // Added to, and applied on top of, every authored Transform
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 orientation_euler_degrees = glm::vec3(0.0f);
+};
+
+// Passed to every component loader while a prefab is instantiated
+struct PrefabContext
+{
+    const ServiceProvider& service_provider;
+    const PrefabSpawn& spawn;
+    bool headless;
+
+    // Every entity of the instance, components can refer to them by index
+    std::span<Entity* const> entities;
+
+    Entity& GetEntity(uint32_t index) const;
+};
+
+/**
+ * Builds entities from prefabs authored as JSON in resources/prefabs. Each
+ * file is compiled once into a binary Prefab, and instantiating it only walks
+ * that blob: component data is copied straight out of it, and no JSON is
+ * parsed while a scene loads.
+ *
+ * Components take part by registering a loader: a compile function that turns
+ * the component's JSON into bytes, and an instantiate function that adds the
+ * component to an entity and reads the same bytes back
+ */
+class PrefabService final : public Service
+{
+  public:
+    using CompileFunction = bool (*)(const rapidjson::Value& node,
+                                     PrefabWriter& writer);
+    using InstantiateFunction = void (*)(Entity& entity, PrefabReader& reader,
+                                         const PrefabContext& context);
+
+    PrefabService();
+
+    void RegisterComponent(std::string_view type, CompileFunction compile,
+                           InstantiateFunction instantiate);
+
+    // For components that are added as is, without any data
+    template <class ComponentType>
+        requires std::derived_from<ComponentType, Component>
+    void RegisterComponent(std::string_view type)
+    {
+        RegisterComponent(type, nullptr, &AddComponent<ComponentType>);
+    }
+
+    // Compiles every prefab file, all component types must be registered
+    void LoadPrefabs();
+    bool LoadPrefabFile(const std::string& path);
+    bool CompilePrefab(const rapidjson::Value& node,
+                       std::vector<std::byte>& out);
+
+    bool HasPrefab(const std::string& name) const;
+    const Prefab& GetPrefab(const std::string& name) const;
+
+    // Returns the prefab's first entity
+    Entity& Instantiate(Scene& scene, const std::string& name,
+                        const PrefabSpawn& spawn = {});
+
+    // From Service
+    void OnInit() override;
+    void OnStart(ServiceProvider& service_provider) override;
+    void OnUpdate(const FrameContext& frame) override;
+    void OnCleanup() override;
+    std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
+
+  private:
+    struct ComponentLoader
+    {
+        CompileFunction compile;
+        InstantiateFunction instantiate;
+    };
+
+    struct LoadedPrefab
+    {
+        Prefab prefab;
+
+        // Resolved once per component type, indexed like the prefab's types
+        std::vector<InstantiateFunction> instantiate;
+    };
+
+    jss::object_ptr<ServiceProvider> service_provider_;
+    std::unordered_map<std::string, ComponentLoader> loaders_;
+    std::unordered_map<std::string, LoadedPrefab> prefabs_;
+
+    void RegisterEngineComponents();
+
+    template <class ComponentType>
+    static void AddComponent(Entity& entity, PrefabReader& reader,
+                             const PrefabContext& context)
+    {
+        entity.AddComponent<ComponentType>();
+    }
+};
@@ -0,0 +1,306 @@
+#include "engine/profiling/ProfilerService.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+
+#include "engine/core/debug/Log.h"
+#include "engine/input/InputService.h"
+#include "engine/service/ServiceProvider.h"
+
+using debug::ProfileCounter;
+using debug::ProfileZone;
+using debug::Profiler;
+using std::string;
+using std::string_view;
+using std::vector;
+
+static constexpr const char* kTracePath = "profile-trace.json";
+static constexpr float kRowHeight = 20.0f;
+static constexpr double kNanosToMillis = 1.0 / 1000000.0;
+
+static ImU32 ZoneColor(string_view name)
+{
+    // Same name always gets the same colour so zones are easy to follow
+    const size_t hash = std::hash<string_view>{}(name);
+    const float hue = static_cast<float>(hash % 360) / 360.0f;
+    return ImColor::HSV(hue, 0.55f, 0.75f);
+}
+
+ProfilerService::ProfilerService()
+    : input_service_(nullptr),
+      show_menu_(false),
+      freeze_(false),
+      frame_{},
+      frame_zones_(),
+      counters_()
+{
+}
+
+void ProfilerService::OnInit()
+{
+}
+
+void ProfilerService::OnStart(ServiceProvider& service_provider)
+{
+    input_service_ = &service_provider.GetService<InputService>();
+
+    GetEventBus().Subscribe<OnGuiEvent>(this);
+}
+
+void ProfilerService::OnUpdate(const FrameContext& frame)
+{
+    if (input_service_->IsKeyPressed(GLFW_KEY_F7))
+    {
+        show_menu_ = !show_menu_;
+    }
+
+    if (input_service_->IsKeyPressed(GLFW_KEY_F8))
+    {
+        SaveTrace();
+    }
+
+    if (show_menu_ && !freeze_)
+    {
+        CaptureLastFrame();
+    }
+}
+
+void ProfilerService::OnCleanup()
+{
+}
+
+string_view ProfilerService::GetName() const
+{
+    return "ProfilerService";
+}
+
+ServiceAccess ProfilerService::GetAccess() const
+{
+    return ServiceAccess{.reads = service_access::kInput,
+                         .writes = service_access::kNone,
+                         .main_thread = false};
+}
+
+void ProfilerService::OnGui()
+{
+    if (!show_menu_)
+    {
+        return;
+    }
+
+    if (!ImGui::Begin("Profiler", &show_menu_))
+    {
+        ImGui::End();
+        return;
+    }
+
+    bool enabled = Profiler::IsEnabled();
+    if (ImGui::Checkbox("Enabled", &enabled))
+    {
+        Profiler::SetEnabled(enabled);
+    }
+
+    ImGui::SameLine();
+    ImGui::Checkbox("Freeze", &freeze_);
+
+    ImGui::SameLine();
+    if (ImGui::Button("Save Trace"))
+    {
+        SaveTrace();
+    }
+
+    const double frame_ms =
+        static_cast<double>(frame_.end_ns - frame_.start_ns) * kNanosToMillis;
+    ImGui::Text("Frame %llu: %.3f ms",
+                static_cast<unsigned long long>(frame_.index), frame_ms);
+
+    ImGui::Separator();
+    DrawFlameGraph();
+
+    ImGui::Separator();
+    DrawZoneTable();
+
+    ImGui::Separator();
+    DrawCounterTable();
+
+    ImGui::End();
+}
+
+void ProfilerService::SaveTrace()
+{
+    if (Profiler::WriteChromeTrace(kTracePath))
+    {
+        debug::LogInfo("Saved profiler trace to: {}", kTracePath);
+    }
+    else
+    {
+        debug::LogError("Failed to save profiler trace to: {}", kTracePath);
+    }
+}
+
+void ProfilerService::CaptureLastFrame()
+{
+    frame_ = Profiler::GetLastFrame();
+    frame_zones_ = Profiler::CollectZones(frame_.start_ns);
+    counters_ = Profiler::GetLatestCounters();
+
+    std::erase_if(frame_zones_,
+                  [this](const ProfileZone& zone)
+                  {
+                      return zone.start_ns < frame_.start_ns ||
+                             zone.end_ns > frame_.end_ns;
+                  });
+}
+
+void ProfilerService::DrawFlameGraph()
+{
+    if (frame_zones_.empty() || frame_.end_ns <= frame_.start_ns)
+    {
+        ImGui::Text("No zones captured");
+        return;
+    }
+
+    // Number of nested rows needed for each thread
+    std::map<uint32_t, uint32_t> thread_rows;
+    for (auto& zone : frame_zones_)
+    {
+        uint32_t& rows = thread_rows[zone.thread_id];
+        rows = std::max(rows, zone.depth + 1);
+    }
+
+    const double frame_ns = static_cast<double>(frame_.end_ns - frame_.start_ns);
+    const float width = ImGui::GetContentRegionAvail().x;
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+
+    for (auto& [thread_id, rows] : thread_rows)
+    {
+        ImGui::Text("Thread %u", thread_id);
+
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const string button_id = "##thread" + std::to_string(thread_id);
+        ImGui::InvisibleButton(button_id.c_str(),
+                               ImVec2(width, rows * kRowHeight));
+
+        for (auto& zone : frame_zones_)
+        {
+            if (zone.thread_id != thread_id)
+            {
+                continue;
+            }
+
+            const double start = (zone.start_ns - frame_.start_ns) / frame_ns;
+            const double end = (zone.end_ns - frame_.start_ns) / frame_ns;
+
+            const ImVec2 min(origin.x + static_cast<float>(start) * width,
+                             origin.y + zone.depth * kRowHeight);
+            const ImVec2 max(
+                std::max(origin.x + static_cast<float>(end) * width,
+                         min.x + 1.0f),
+                min.y + kRowHeight - 1.0f);
+
+            draw_list->AddRectFilled(min, max, ZoneColor(zone.name));
+
+            const ImVec2 text_size = ImGui::CalcTextSize(
+                zone.name.data(), zone.name.data() + zone.name.size());
+            if (text_size.x < max.x - min.x)
+            {
+                draw_list->AddText(ImVec2(min.x + 2.0f, min.y + 2.0f),
+                                   IM_COL32_WHITE, zone.name.data(),
+                                   zone.name.data() + zone.name.size());
+            }
+
+            if (ImGui::IsMouseHoveringRect(min, max))
+            {
+                const double duration_ms =
+                    static_cast<double>(zone.end_ns - zone.start_ns) *
+                    kNanosToMillis;
+
+                ImGui::BeginTooltip();
+                ImGui::Text("%.*s", static_cast<int>(zone.name.size()),
+                            zone.name.data());
+                ImGui::Text("%.3f ms", duration_ms);
+                ImGui::EndTooltip();
+            }
+        }
+    }
+}
+
+void ProfilerService::DrawZoneTable()
+{
+    struct ZoneTotal
+    {
+        double total_ms = 0.0;
+        uint32_t count = 0;
+    };
+
+    std::map<string_view, ZoneTotal> totals;
+    for (auto& zone : frame_zones_)
+    {
+        ZoneTotal& total = totals[zone.name];
+        total.total_ms +=
+            static_cast<double>(zone.end_ns - zone.start_ns) * kNanosToMillis;
+        total.count++;
+    }
+
+    vector<std::pair<string_view, ZoneTotal>> sorted(totals.begin(),
+                                                     totals.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& a, const auto& b)
+              { return a.second.total_ms > b.second.total_ms; });
+
+    if (!ImGui::BeginTable("Zones", 3, ImGuiTableFlags_Borders))
+    {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Zone");
+    ImGui::TableSetupColumn("Total (ms)");
+    ImGui::TableSetupColumn("Calls");
+    ImGui::TableHeadersRow();
+
+    for (auto& [name, total] : sorted)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%.*s", static_cast<int>(name.size()), name.data());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", total.total_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", total.count);
+    }
+
+    ImGui::EndTable();
+}
+
+void ProfilerService::DrawCounterTable()
+{
+    if (counters_.empty())
+    {
+        return;
+    }
+
+    if (!ImGui::BeginTable("Counters", 2, ImGuiTableFlags_Borders))
+    {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Counter");
+    ImGui::TableSetupColumn("Value");
+    ImGui::TableHeadersRow();
+
+    for (auto& counter : counters_)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%.*s", static_cast<int>(counter.name.size()),
+                    counter.name.data());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", counter.value);
+    }
+
+    ImGui::EndTable();
+}
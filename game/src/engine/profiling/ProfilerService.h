@@ -0,0 +1,44 @@
+#pragma once
+
+#include <object_ptr.hpp>
+#include <vector>
+
+#include "engine/core/debug/Profiler.h"
+#include "engine/fwd/FwdServices.h"
+#include "engine/gui/OnGuiEvent.h"
+#include "engine/service/Service.h"
+
+class ProfilerService final : public Service,
+                              public IEventSubscriber<OnGuiEvent>
+{
+  public:
+    ProfilerService();
+
+    // From Service
+    void OnInit() override;
+    void OnStart(ServiceProvider& service_provider) override;
+    void OnUpdate(const FrameContext& frame) override;
+    void OnCleanup() override;
+    std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
+
+    // From IEventSubscriber<OnGuiEvent>
+    void OnGui() override;
+
+    void SaveTrace();
+
+  private:
+    jss::object_ptr<InputService> input_service_;
+    bool show_menu_;
+    bool freeze_;
+
+    // Zones from the last complete frame, kept around while frozen
+    debug::ProfileFrame frame_;
+    std::vector<debug::ProfileZone> frame_zones_;
+    std::vector<debug::ProfileCounter> counters_;
+
+    void CaptureLastFrame();
+    void DrawFlameGraph();
+    void DrawZoneTable();
+    void DrawCounterTable();
+};
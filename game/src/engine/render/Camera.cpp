@@ -44,9 +44,6 @@ void Camera::OnInit(const ServiceProvider& service_provider)
     // Components
     transform_ = &GetEntity().GetComponent<Transform>();
 
-    // Event subscriptions
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
-
     // Init logic
     render_service_->RegisterCamera(*this);
     UpdateProjectionMatrix();
@@ -127,7 +124,7 @@ const mat4& Camera::GetViewMatrix() const
     return view_matrix_;
 }
 
-void Camera::OnUpdate(const Timestep& delta_time)
+void Camera::UpdateMatrices()
 {
     UpdateViewMatrix();
     UpdateFrustumVertices();
@@ -5,7 +5,6 @@
 
 #include "engine/core/math/Cuboid.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "engine/scene/Transform.h"
 
 class RenderService;
@@ -20,14 +19,13 @@ enum class CameraType : uint8_t
 
 struct CameraView
 {
-    Transform* camera_transform;
     glm::vec3 pos;
     glm::mat4 view_matrix;
     glm::mat4 proj_matrix;
     glm::mat4 view_proj_matrix;
 };
 
-class Camera final : public Component, public IEventSubscriber<OnUpdateEvent>
+class Camera final : public Component
 {
   public:
     Camera();
@@ -39,14 +37,15 @@ class Camera final : public Component, public IEventSubscriber<OnUpdateEvent>
     void SetAspectRatio(float aspect_ratio);
     void SetType(CameraType type);
 
+    // Follows the transform, RenderService calls this before capturing
+    void UpdateMatrices();
+
     // From Component
     void OnInit(const ServiceProvider& service_provider) override;
     void OnDebugGui() override;
     void OnDestroy() override;
     std::string_view GetName() const override;
 
-    // From IEventSubscriber<OnUpdateEvent>
-    void OnUpdate(const Timestep& delta_time) override;
     CameraType GetType() const;
     float GetFovDegrees() const;
     float GetAspectRatio() const;
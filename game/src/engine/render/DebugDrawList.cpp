@@ -68,6 +68,11 @@ void DebugDrawList::AddCuboid(const Cuboid& cuboid, const Color4u& color)
                                 });
 }
 
+void DebugDrawList::AddLines(const std::vector<DebugVertex>& lines)
+{
+    lines_.insert(lines_.end(), lines.begin(), lines.end());
+}
+
 void DebugDrawList::Prepare()
 {
     // TODO(radu): OPTIMIZATION - Would be better to allocate buffer at start
@@ -91,4 +96,9 @@ void DebugDrawList::Clear()
 bool DebugDrawList::HasItems() const
 {
     return !lines_.empty();
+}
+
+const std::vector<DebugVertex>& DebugDrawList::GetLines() const
+{
+    return lines_;
 }
\ No newline at end of file
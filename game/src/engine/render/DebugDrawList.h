@@ -32,12 +32,14 @@ class DebugDrawList
 
     void AddLine(const DebugVertex& start, const DebugVertex& end);
     void AddCuboid(const Cuboid& cuboid, const Color4u& color);
+    void AddLines(const std::vector<DebugVertex>& lines);
 
     void Prepare();
     void Draw();
     void Clear();
 
     bool HasItems() const;
+    const std::vector<DebugVertex>& GetLines() const;
 
   private:
     VertexArray vertex_array_;
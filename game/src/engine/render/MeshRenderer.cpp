@@ -4,6 +4,7 @@
 #include <assimp/scene.h>        // Output data structure
 #include <imgui.h>
 
+#include <algorithm>
 #include <assimp/Importer.hpp>  // C++ importer interface
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -23,7 +24,8 @@ static const MaterialProperties kDefaultMaterialProperties = {
 void MeshRenderer::OnInit(const ServiceProvider& service_provider)
 {
     // Services
-    render_service_ = &service_provider.GetService<RenderService>();
+    // Optional, meshes are still tracked when running headless
+    render_service_ = service_provider.TryGetService<RenderService>();
     asset_service_ = &service_provider.GetService<AssetService>();
 
     // Components
@@ -64,7 +66,10 @@ void MeshRenderer::OnDebugGui()
 
 void MeshRenderer::OnDestroy()
 {
-    render_service_->UnregisterRenderable(GetEntity());
+    if (render_service_)
+    {
+        render_service_->UnregisterRenderable(GetEntity());
+    }
 }
 
 std::string_view MeshRenderer::GetName() const
@@ -76,21 +81,32 @@ void MeshRenderer::SetMesh(const RenderableMesh& mesh)
 {
     if (meshes_.size() > 0)
     {
-        render_service_->UnregisterRenderable(GetEntity());
+        if (render_service_)
+        {
+            render_service_->UnregisterRenderable(GetEntity());
+        }
+
         meshes_.clear();
     }
 
     ASSERT_MSG(mesh.mesh, "Must have valid mesh data");
 
     meshes_ = {mesh};
-    render_service_->RegisterRenderable(GetEntity(), *this);
+    if (render_service_)
+    {
+        render_service_->RegisterRenderable(GetEntity(), *this);
+    }
 }
 
 void MeshRenderer::SetMeshes(const vector<RenderableMesh>& meshes)
 {
     if (meshes_.size() > 0)
     {
-        render_service_->UnregisterRenderable(GetEntity());
+        if (render_service_)
+        {
+            render_service_->UnregisterRenderable(GetEntity());
+        }
+
         meshes_.clear();
     }
 
@@ -100,10 +116,38 @@ void MeshRenderer::SetMeshes(const vector<RenderableMesh>& meshes)
     }
 
     meshes_ = meshes;
-    render_service_->RegisterRenderable(GetEntity(), *this);
+    if (render_service_)
+    {
+        render_service_->RegisterRenderable(GetEntity(), *this);
+    }
 }
 
 const vector<RenderableMesh>& MeshRenderer::GetMeshes() const
 {
     return meshes_;
 }
+
+MeshRenderer::SnapshotState MeshRenderer::SaveSnapshot() const
+{
+    return SnapshotState{.meshes = meshes_};
+}
+
+void MeshRenderer::RestoreSnapshot(const SnapshotState& state)
+{
+    // Setting meshes rebuilds the entity's GPU buffers, so skip it if it can
+    auto same_mesh = [](const RenderableMesh& a, const RenderableMesh& b)
+    {
+        const MaterialProperties& x = a.material_properties;
+        const MaterialProperties& y = b.material_properties;
+
+        return a.mesh == b.mesh && x.albedo_texture == y.albedo_texture &&
+               x.albedo_color == y.albedo_color && x.specular == y.specular &&
+               x.shininess == y.shininess;
+    };
+
+    if (!std::equal(meshes_.begin(), meshes_.end(), state.meshes.begin(),
+                    state.meshes.end(), same_mesh))
+    {
+        SetMeshes(state.meshes);
+    }
+}
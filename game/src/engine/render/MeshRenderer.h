@@ -21,12 +21,20 @@ struct RenderableMesh
 class MeshRenderer final : public Component
 {
   public:
+    struct SnapshotState
+    {
+        std::vector<RenderableMesh> meshes;
+    };
+
     MeshRenderer() = default;
 
     void SetMesh(const RenderableMesh& mesh);
     void SetMeshes(const std::vector<RenderableMesh>& meshes);
     const std::vector<RenderableMesh>& GetMeshes() const;
 
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     // From Component
     void OnInit(const ServiceProvider& service_provider) override;
     void OnDebugGui() override;
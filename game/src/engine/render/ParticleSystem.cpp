@@ -18,15 +18,13 @@ using glm::vec4;
 using std::string;
 using std::vector;
 
-ParticleSystem::ParticleSystem(ParticleDrawList& draw_list,
-                               const ParticleSystemProperties& properties)
-    : draw_list_(draw_list),
-      particles_{},
+ParticleSystem::ParticleSystem(const ParticleSystemProperties& properties)
+    : particles_{},
       properties_(properties)
 {
 }
 
-void ParticleSystem::Update(const Timestep& delta_time)
+void ParticleSystem::Update(const Timestep& delta_time, vector<Particle>& out)
 {
     const float sec_delta = static_cast<float>(delta_time.GetSeconds());
 
@@ -50,7 +48,7 @@ void ParticleSystem::Update(const Timestep& delta_time)
             glm::mix(properties_.size_start, properties_.size_end, lifetime_t);
 
         // Submit to GPU
-        draw_list_.AddParticle(particle);
+        out.push_back(particle);
 
         // Update state for next render
         particle.velocity += properties_.acceleration * sec_delta;
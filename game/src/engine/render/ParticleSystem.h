@@ -28,17 +28,16 @@ struct ParticleSystemProperties
 class ParticleSystem
 {
   public:
-    ParticleSystem(ParticleDrawList& draw_list,
-                   const ParticleSystemProperties& properties);
+    ParticleSystem(const ParticleSystemProperties& properties);
 
-    void Update(const Timestep& delta_time);
+    // Appends every live particle to `out`, ready to be drawn
+    void Update(const Timestep& delta_time, std::vector<Particle>& out);
     void Emit(const glm::vec3& pos);
 
     void SetProperties(const ParticleSystemProperties& properties);
     ParticleSystemProperties& GetProperties();
 
   private:
-    ParticleDrawList& draw_list_;
     std::vector<Particle> particles_;
     ParticleSystemProperties properties_;
 
@@ -10,13 +10,16 @@
 #include "engine/App.h"
 #include "engine/asset/AssetService.h"
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/core/gui/PropertyWidgets.h"
 #include "engine/input/InputService.h"
+#include "engine/physics/PhysicsService.h"
 #include "engine/render/Camera.h"
 #include "engine/render/Material.h"
 #include "engine/render/MeshRenderer.h"
 #include "engine/render/ParticleSystem.h"
 #include "engine/render/PointLight.h"
+#include "engine/scene/Scene.h"
 #include "engine/service/ServiceProvider.h"
 
 using glm::ivec2;
@@ -33,12 +36,20 @@ static constexpr float kFloatMax = std::numeric_limits<float>::max();
 RenderService::RenderService()
     : input_service_(nullptr),
       asset_service_(nullptr),
+      physics_service_(nullptr),
+      active_scene_(nullptr),
       render_data_(make_unique<SceneRenderData>()),
       particle_systems_{},
       depth_pass_(*render_data_),
       geometry_pass_(*render_data_, depth_pass_.GetShadowMaps()),
       post_process_pass_(*render_data_, geometry_pass_.GetScreenTexture()),
       debug_draw_list_(),
+      render_debug_draw_list_(),
+      laser_quads_{},
+      pending_registers_{},
+      pending_unregisters_{},
+      snapshots_{},
+      front_snapshot_(0),
       show_debug_menu_(false),
       debug_draw_camera_frustums_(false)
 {
@@ -58,8 +69,10 @@ void RenderService::RegisterRenderable(const Entity& entity,
 
     render_data_->entities.push_back(&entity);
 
-    depth_pass_.RegisterRenderable(entity, renderer);
-    geometry_pass_.RegisterRenderable(entity, renderer);
+    // Entities can be spawned by the simulation thread, GL buffers are only
+    // created on the main thread
+    pending_registers_.push_back(
+        PendingRenderable{.entity = &entity, .renderer = &renderer});
 }
 
 void RenderService::UnregisterRenderable(const Entity& entity)
@@ -69,15 +82,23 @@ void RenderService::UnregisterRenderable(const Entity& entity)
         std::erase_if(render_data_->entities, [target_id](const Entity* x)
                       { return x->GetId() == target_id; });
 
-    if (count > 0)
+    if (count == 0)
     {
-        depth_pass_.UnregisterRenderable(entity);
-        geometry_pass_.UnregisterRenderable(entity);
+        debug::LogWarn(
+            "Attempted to unregister a renderable entity that was never "
+            "registered");
+        return;
     }
 
-    debug::LogWarn(
-        "Attempted to unregister a renderable entity that was never "
-        "registered");
+    // Never uploaded, so there's nothing to free
+    size_t cancelled = std::erase_if(
+        pending_registers_, [target_id](const PendingRenderable& x)
+        { return x.entity->GetId() == target_id; });
+
+    if (cancelled == 0)
+    {
+        pending_unregisters_.push_back(target_id);
+    }
 }
 
 void RenderService::RegisterCamera(Camera& camera)
@@ -127,13 +148,14 @@ void RenderService::OnStart(ServiceProvider& service_provider)
     // Service dependencies
     input_service_ = &service_provider.GetService<InputService>();
     asset_service_ = &service_provider.GetService<AssetService>();
+    physics_service_ = service_provider.TryGetService<PhysicsService>();
 
     // Events
     GetEventBus().Subscribe<OnGuiEvent>(this);
 
     // Render passes
     render_data_->asset_service = asset_service_.get();
-    render_data_->debug_draw_list = &debug_draw_list_;
+    render_data_->debug_draw_list = &render_debug_draw_list_;
 
     depth_pass_.Init();
     geometry_pass_.Init();
@@ -144,12 +166,31 @@ void RenderService::OnStart(ServiceProvider& service_provider)
 
 void RenderService::OnSceneLoaded(Scene& scene)
 {
+    active_scene_ = &scene;
+
     depth_pass_.ResetState();
     geometry_pass_.ResetState();
 
     render_data_->cameras.clear();
     render_data_->entities.clear();
     render_data_->point_lights.clear();
+
+    pending_registers_.clear();
+    pending_unregisters_.clear();
+    laser_quads_.clear();
+    debug_draw_list_.Clear();
+
+    for (auto& snapshot : snapshots_)
+    {
+        snapshot.Clear();
+    }
+
+    render_data_->snapshot = nullptr;
+}
+
+void RenderService::OnSceneUnloaded(Scene& scene)
+{
+    active_scene_ = nullptr;
 }
 
 void RenderService::OnWindowSizeChanged(int width, int height)
@@ -173,7 +214,7 @@ void RenderService::OnWindowSizeChanged(int width, int height)
     }
 }
 
-void RenderService::OnUpdate()
+void RenderService::OnUpdate(const FrameContext& frame)
 {
     // Debug menu
     if (input_service_->IsKeyPressed(GLFW_KEY_F2))
@@ -181,17 +222,64 @@ void RenderService::OnUpdate()
         show_debug_menu_ = !show_debug_menu_;
     }
 
-    glFrontFace(GL_CCW);
+    render_data_->total_time += frame.delta_time.GetSeconds();
 
-    if (debug_draw_camera_frustums_)
+    FlushPendingRenderables();
+}
+
+void RenderService::OnPublishSnapshot(const FrameContext& frame)
+{
+    PROFILE_SCOPE("RenderService::OnPublishSnapshot");
+
+    // Only this thread writes the index, and the main thread never reads the
+    // back snapshot, so this can be relaxed
+    const size_t front = front_snapshot_.load(std::memory_order_relaxed);
+    RenderSnapshot& snapshot = snapshots_[1 - front];
+    snapshot.Clear();
+    snapshot.tick = snapshots_[front].tick + 1;
+
+    UpdateParticleSystems(frame.delta_time, snapshot);
+    CaptureCameras(snapshot);
+    CaptureRenderables(snapshot);
+
+    std::swap(snapshot.laser_quads, laser_quads_);
+    snapshot.debug_lines = debug_draw_list_.GetLines();
+    debug_draw_list_.Clear();
+
+    // Rendering overlaps the simulation thread, so the release makes the
+    // snapshot's contents visible before the main thread can pick it
+    front_snapshot_.store(1 - front, std::memory_order_release);
+}
+
+void RenderService::OnRender()
+{
+    const RenderSnapshot& snapshot =
+        snapshots_[front_snapshot_.load(std::memory_order_acquire)];
+    render_data_->snapshot = &snapshot;
+
+    ParticleDrawList& particle_draw_list = geometry_pass_.GetParticleDrawList();
+    for (const auto& system_particles : snapshot.particles)
     {
-        DrawCameraFrustums();
+        for (const Particle& particle : system_particles)
+        {
+            particle_draw_list.AddParticle(particle);
+        }
     }
 
-    const Timestep& delta = GetApp().GetDeltaTime();
-    render_data_->total_time += delta.GetSeconds();
+    LaserMaterial& laser_material = geometry_pass_.GetLaserMaterial();
+    for (const auto& quad : snapshot.laser_quads)
+    {
+        laser_material.AddQuad(quad);
+    }
 
-    UpdateParticleSystems(delta);
+    render_debug_draw_list_.AddLines(snapshot.debug_lines);
+
+    if (debug_draw_camera_frustums_)
+    {
+        DrawCameraFrustums(snapshot);
+    }
+
+    glFrontFace(GL_CCW);
 
     depth_pass_.Render();
     geometry_pass_.Render();
@@ -207,6 +295,14 @@ std::string_view RenderService::GetName() const
     return "RenderService";
 }
 
+ServiceAccess RenderService::GetAccess() const
+{
+    return ServiceAccess{
+        .reads = service_access::kInput | service_access::kScene,
+        .writes = service_access::kRender,
+        .main_thread = true};
+}
+
 void RenderService::OnGui()
 {
     if (!show_debug_menu_)
@@ -315,19 +411,37 @@ DebugDrawList& RenderService::GetDebugDrawList()
     return debug_draw_list_;
 }
 
-LaserMaterial& RenderService::GetLaserMaterial()
+void RenderService::AddLaserQuad(const Quad<LaserVertex>& quad)
 {
-    return geometry_pass_.GetLaserMaterial();
+    laser_quads_.push_back(quad);
+}
+
+void RenderService::FlushPendingRenderables()
+{
+    for (const uint32_t entity_id : pending_unregisters_)
+    {
+        depth_pass_.UnregisterRenderable(entity_id);
+        geometry_pass_.UnregisterRenderable(entity_id);
+    }
+
+    for (const auto& pending : pending_registers_)
+    {
+        depth_pass_.RegisterRenderable(*pending.entity, *pending.renderer);
+        geometry_pass_.RegisterRenderable(*pending.entity, *pending.renderer);
+    }
+
+    pending_unregisters_.clear();
+    pending_registers_.clear();
 }
 
-void RenderService::DrawCameraFrustums()
+void RenderService::DrawCameraFrustums(const RenderSnapshot& snapshot)
 {
-    for (Camera* camera : render_data_->cameras)
+    for (const CameraSnapshot& camera : snapshot.cameras)
     {
-        if (camera->GetType() == CameraType::kNormal)
+        if (camera.type == CameraType::kNormal)
         {
-            debug_draw_list_.AddCuboid(camera->GetFrustumWorldVertices(),
-                                       Color4u(0, 255, 0, 255));
+            render_debug_draw_list_.AddCuboid(camera.frustum_world,
+                                              Color4u(0, 255, 0, 255));
         }
     }
 }
@@ -349,12 +463,9 @@ ParticleSystem& RenderService::GetParticleSystem(const string& name)
 
 void RenderService::BuildParticleSystems()
 {
-    ParticleDrawList& particle_draw_list = geometry_pass_.GetParticleDrawList();
-
     particle_systems_.push_back({
         .name = "sparks",
         .particle_system = make_unique<ParticleSystem>(
-            particle_draw_list,
             ParticleSystemProperties{
                 .acceleration = vec3(0.0f, -10.0f, 0.0f),
                 .color_start = vec4(0.8f, 0.3f, 0.3f, 0.65f),
@@ -373,7 +484,6 @@ void RenderService::BuildParticleSystems()
     particle_systems_.push_back({
         .name = "sparks_hit",
         .particle_system = make_unique<ParticleSystem>(
-            particle_draw_list,
             ParticleSystemProperties{
                 .acceleration = vec3(0.0f, -10.0f, 0.0f),
                 .color_start = vec4(1.0f, 0.0f, 0.0f, 0.8f),
@@ -392,7 +502,6 @@ void RenderService::BuildParticleSystems()
     particle_systems_.push_back({
         .name = "explosion",
         .particle_system = make_unique<ParticleSystem>(
-            particle_draw_list,
             ParticleSystemProperties{
                 .acceleration = vec3(0.0f, -10.0f, 0.0f),
                 .color_start = vec4(1.0f, 0.0f, 0.0f, 1.0f),
@@ -411,7 +520,6 @@ void RenderService::BuildParticleSystems()
     particle_systems_.push_back({
         .name = "exhaust",
         .particle_system = make_unique<ParticleSystem>(
-            particle_draw_list,
             ParticleSystemProperties{
                 .acceleration = vec3(0.0f, 4.0f, 0.0f),
                 .color_start = vec4(1.0f, 1.0f, 1.0f, 0.19f),
@@ -428,10 +536,80 @@ void RenderService::BuildParticleSystems()
     });
 }
 
-void RenderService::UpdateParticleSystems(const Timestep& delta_time)
+void RenderService::UpdateParticleSystems(const Timestep& delta_time,
+                                          RenderSnapshot& snapshot)
 {
-    for (auto& entry : particle_systems_)
+    snapshot.particles.resize(particle_systems_.size());
+
+    // Every system fills its own list, so they can update in parallel
+    GetApp().GetJobSystem().ParallelFor(
+        particle_systems_.size(), 1,
+        [this, &delta_time, &snapshot](size_t begin, size_t end)
+        {
+            PROFILE_SCOPE("ParticleSystem::Update");
+
+            for (size_t i = begin; i < end; i++)
+            {
+                particle_systems_[i].particle_system->Update(
+                    delta_time, snapshot.particles[i]);
+            }
+        });
+}
+
+void RenderService::CaptureCameras(RenderSnapshot& snapshot)
+{
+    if (!active_scene_)
     {
-        entry.particle_system->Update(delta_time);
+        return;
     }
+
+    // Matrices are only needed here, after everything has moved this tick
+    active_scene_->ForEachComponent<Camera>(
+        [&snapshot](Camera& camera)
+        {
+            camera.UpdateMatrices();
+
+            const Transform& transform =
+                camera.GetEntity().GetComponent<Transform>();
+
+            snapshot.cameras.push_back(CameraSnapshot{
+                .type = camera.GetType(),
+                .pos = transform.GetPosition(),
+                .view_matrix = camera.GetViewMatrix(),
+                .proj_matrix = camera.GetProjectionMatrix(),
+                .fov_degrees = camera.GetFovDegrees(),
+                .aspect_ratio = camera.GetAspectRatio(),
+                .frustum_world = camera.GetFrustumWorldVertices(),
+            });
+        });
+}
+
+void RenderService::CaptureRenderables(RenderSnapshot& snapshot)
+{
+    // Bodies are drawn between their last two physics ticks, so rendering
+    // stays smooth when the frame rate and tick rate don't line up
+    const float alpha =
+        physics_service_ ? physics_service_->GetInterpolationAlpha() : 1.0f;
+
+    if (!active_scene_)
+    {
+        return;
+    }
+
+    active_scene_->View<Transform, MeshRenderer>().ForEach(
+        [&](Entity& entity, Transform& transform, MeshRenderer& renderer)
+        {
+            RenderableSnapshot& renderable =
+                snapshot.renderables[entity.GetId()];
+            renderable.model_matrix =
+                transform.GetInterpolatedModelMatrix(alpha);
+            renderable.normal_matrix =
+                transform.GetInterpolatedNormalMatrix(alpha);
+            renderable.materials.clear();
+
+            for (const auto& mesh : renderer.GetMeshes())
+            {
+                renderable.materials.push_back(mesh.material_properties);
+            }
+        });
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <object_ptr.hpp>
 #include <unordered_map>
@@ -11,6 +12,7 @@
 #include "engine/gui/OnGuiEvent.h"
 #include "engine/render/DebugDrawList.h"
 #include "engine/render/ParticleDrawList.h"
+#include "engine/render/RenderSnapshot.h"
 #include "engine/render/SceneRenderData.h"
 #include "engine/render/passes/DepthPass.h"
 #include "engine/render/passes/GeometryPass.h"
@@ -44,22 +46,35 @@ class RenderService final : public Service, public IEventSubscriber<OnGuiEvent>
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
     void OnSceneLoaded(Scene& scene) override;
+    void OnSceneUnloaded(Scene& scene) override;
     void OnWindowSizeChanged(int width, int height) override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
+    void OnPublishSnapshot(const FrameContext& frame) override;
+    void OnRender() override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     // From IEventSubscriber<OnGuiEvent>
     void OnGui() override;
 
+    // Simulation side, lines are copied into the next snapshot
     DebugDrawList& GetDebugDrawList();
-    LaserMaterial& GetLaserMaterial();
+    void AddLaserQuad(const Quad<LaserVertex>& quad);
 
     ParticleSystem& GetParticleSystem(const std::string& name);
 
   private:
+    struct PendingRenderable
+    {
+        const Entity* entity;
+        const MeshRenderer* renderer;
+    };
+
     jss::object_ptr<InputService> input_service_;
     jss::object_ptr<AssetService> asset_service_;
+    jss::object_ptr<PhysicsService> physics_service_;
+    jss::object_ptr<Scene> active_scene_;
 
     std::unique_ptr<SceneRenderData> render_data_;
     std::vector<ParticleSystemEntry> particle_systems_;
@@ -67,10 +82,23 @@ class RenderService final : public Service, public IEventSubscriber<OnGuiEvent>
     GeometryPass geometry_pass_;
     PostProcessPass post_process_pass_;
     DebugDrawList debug_draw_list_;
+    DebugDrawList render_debug_draw_list_;
+    std::vector<Quad<LaserVertex>> laser_quads_;
+    std::vector<PendingRenderable> pending_registers_;
+    std::vector<uint32_t> pending_unregisters_;
+    RenderSnapshot snapshots_[2];
+
+    // Flipped by the simulation thread while the main thread may be rendering
+    // the previous tick, so the main thread loads it once per OnRender
+    std::atomic<size_t> front_snapshot_;
     bool show_debug_menu_;
     bool debug_draw_camera_frustums_;
 
-    void DrawCameraFrustums();
+    void FlushPendingRenderables();
+    void DrawCameraFrustums(const RenderSnapshot& snapshot);
     void BuildParticleSystems();
-    void UpdateParticleSystems(const Timestep& delta_time);
+    void UpdateParticleSystems(const Timestep& delta_time,
+                               RenderSnapshot& snapshot);
+    void CaptureCameras(RenderSnapshot& snapshot);
+    void CaptureRenderables(RenderSnapshot& snapshot);
 };
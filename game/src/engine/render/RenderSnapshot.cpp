@@ -0,0 +1,24 @@
+#include "engine/render/RenderSnapshot.h"
+
+RenderSnapshot::RenderSnapshot()
+    : tick(0),
+      cameras{},
+      renderables{},
+      particles{},
+      laser_quads{},
+      debug_lines{}
+{
+}
+
+void RenderSnapshot::Clear()
+{
+    cameras.clear();
+    renderables.clear();
+    laser_quads.clear();
+    debug_lines.clear();
+
+    for (auto& system_particles : particles)
+    {
+        system_particles.clear();
+    }
+}
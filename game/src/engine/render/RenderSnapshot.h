@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/math/Cuboid.h"
+#include "engine/core/math/Quad.h"
+#include "engine/render/Camera.h"
+#include "engine/render/DebugDrawList.h"
+#include "engine/render/LaserMaterial.h"
+#include "engine/render/Material.h"
+#include "engine/render/ParticleDrawList.h"
+
+struct CameraSnapshot
+{
+    CameraType type;
+    glm::vec3 pos;
+    glm::mat4 view_matrix;
+    glm::mat4 proj_matrix;
+    float fov_degrees;
+    float aspect_ratio;
+    Cuboid frustum_world;
+};
+
+struct RenderableSnapshot
+{
+    glm::mat4 model_matrix;
+    glm::mat4 normal_matrix;
+    std::vector<MaterialProperties> materials;
+};
+
+/**
+ * Everything the render passes need from one simulation tick. Written by the
+ * simulation thread, then only read by the main thread, so the passes never
+ * look at live entities
+ */
+struct RenderSnapshot
+{
+    uint64_t tick;
+    std::vector<CameraSnapshot> cameras;
+    std::unordered_map<uint32_t, RenderableSnapshot> renderables;
+    std::vector<std::vector<Particle>> particles;
+    std::vector<Quad<LaserVertex>> laser_quads;
+    std::vector<DebugVertex> debug_lines;
+
+    RenderSnapshot();
+
+    // Snapshots are reused every other tick rather than reallocated
+    void Clear();
+};
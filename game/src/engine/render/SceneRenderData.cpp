@@ -5,7 +5,9 @@ SceneRenderData::SceneRenderData()
       cameras{},
       entities{},
       point_lights{},
+      snapshot(nullptr),
       asset_service(nullptr),
+      debug_draw_list(nullptr),
       total_time(0)
 {
 }
\ No newline at end of file
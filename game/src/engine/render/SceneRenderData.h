@@ -7,13 +7,20 @@
 #include "engine/fwd/FwdServices.h"
 
 class DebugDrawList;
+struct RenderSnapshot;
 
 struct SceneRenderData
 {
     glm::ivec2 screen_size;
+
+    // Live components, only for the simulation side to publish snapshots from
     std::vector<Camera*> cameras;
     std::vector<const Entity*> entities;
     std::vector<PointLight*> point_lights;
+
+    // Latest published tick, what the render passes draw
+    const RenderSnapshot* snapshot;
+
     AssetService* asset_service;
     DebugDrawList* debug_draw_list;
     double total_time;
@@ -6,6 +6,7 @@
 
 #include "engine/core/debug/Assert.h"
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/core/gfx/VertexArray.h"
 #include "engine/core/gfx/VertexBuffer.h"
 #include "engine/core/gui/PropertyWidgets.h"
@@ -13,6 +14,7 @@
 #include "engine/render/Camera.h"
 #include "engine/render/DebugDrawList.h"
 #include "engine/render/MeshRenderer.h"
+#include "engine/render/RenderSnapshot.h"
 #include "engine/render/passes/depth/ShadowMap.h"
 #include "engine/scene/Entity.h"
 
@@ -28,7 +30,7 @@ using std::vector;
 
 struct MeshRenderData
 {
-    const Entity* entity;
+    uint32_t entity_id;
     size_t index_count;
     RenderBuffers buffers;
 };
@@ -76,7 +78,7 @@ void DepthPass::RegisterRenderable(const Entity& entity,
                                    const MeshRenderer& renderer)
 {
     auto data = make_unique<MeshRenderData>();
-    data->entity = &entity;
+    data->entity_id = entity.GetId();
 
     // Configure vertex array/buffer and upload data
     data->buffers.vertex_array.Bind();
@@ -117,11 +119,10 @@ void DepthPass::RegisterRenderable(const Entity& entity,
     meshes_.push_back(std::move(data));
 }
 
-void DepthPass::UnregisterRenderable(const Entity& entity)
+void DepthPass::UnregisterRenderable(uint32_t entity_id)
 {
-    const uint32_t target_id = entity.GetId();
-    std::erase_if(render_data_.entities, [target_id](const Entity* x)
-                  { return x->GetId() == target_id; });
+    std::erase_if(meshes_, [entity_id](const unique_ptr<MeshRenderData>& x)
+                  { return x->entity_id == entity_id; });
 }
 
 void DepthPass::Init()
@@ -134,17 +135,19 @@ void DepthPass::Init()
 
 void DepthPass::Render()
 {
+    PROFILE_SCOPE("DepthPass::Render");
+
     if (ShouldRun())
     {
-        for (Camera* camera : render_data_.cameras)
+        for (const CameraSnapshot& camera : render_data_.snapshot->cameras)
         {
             // Only draw shadows for "normal" camera types
-            if (camera->GetType() != CameraType::kNormal)
+            if (camera.type != CameraType::kNormal)
             {
                 continue;
             }
 
-            current_camera_ = camera;
+            current_camera_ = &camera;
             RenderShadowMaps();
         }
     }
@@ -200,14 +203,11 @@ void DepthPass::RenderShadowMaps()
 {
     ASSERT(current_camera_);
 
-    const vec3& camera_pos =
-        current_camera_->GetEntity().GetComponent<Transform>().GetPosition();
-
     ShadowMap::CameraParams camera_params = {
-        .pos = camera_pos,
-        .view_matrix = current_camera_->GetViewMatrix(),
-        .fov_radians = glm::radians(current_camera_->GetFovDegrees()),
-        .aspect_ratio = current_camera_->GetAspectRatio()};
+        .pos = current_camera_->pos,
+        .view_matrix = current_camera_->view_matrix,
+        .fov_radians = glm::radians(current_camera_->fov_degrees),
+        .aspect_ratio = current_camera_->aspect_ratio};
 
     for (auto& shadow_map : shadow_maps_)
     {
@@ -237,15 +237,18 @@ void DepthPass::RenderMeshes(ShadowMap& shadow_map)
     shader_.SetUniform("uLightSpaceMatrix", light_space);
 
     // Render each object
+    const auto& renderables = render_data_.snapshot->renderables;
+
     for (const auto& obj : meshes_)
     {
-        const MeshRenderer& renderer =
-            obj->entity->GetComponent<MeshRenderer>();
-        const Transform& transform = obj->entity->GetComponent<Transform>();
-
-        const mat4& model_matrix = transform.GetModelMatrix();
+        auto renderable_iter = renderables.find(obj->entity_id);
+        if (renderable_iter == renderables.end())
+        {
+            continue;
+        }
 
         // Vert shader vars
+        const mat4& model_matrix = renderable_iter->second.model_matrix;
         shader_.SetUniform("uModelMatrix", model_matrix);
 
         obj->buffers.vertex_array.Bind();
@@ -271,15 +274,13 @@ void DepthPass::RenderDebugCameraBounds(ShadowMap& shadow_map)
     render_data_.debug_draw_list->AddCuboid(shadow_map.GetCameraBounds(),
                                             kDebugColor);
 
-    const vec3& camera_pos =
-        current_camera_->GetEntity().GetComponent<Transform>().GetPosition();
-
     render_data_.debug_draw_list->AddLine(
-        DebugVertex(camera_pos, kDebugColor),
+        DebugVertex(current_camera_->pos, kDebugColor),
         DebugVertex(shadow_map.GetTargetPos(), kDebugColor));
 }
 
 bool DepthPass::ShouldRun()
 {
-    return render_data_.cameras.size() > 0;
+    return render_data_.snapshot &&
+           render_data_.snapshot->cameras.size() > 0;
 }
@@ -9,6 +9,7 @@
 #include "engine/render/RenderBuffers.h"
 #include "engine/render/SceneRenderData.h"
 
+struct CameraSnapshot;
 struct MeshRenderData;
 class ShadowMap;
 
@@ -19,7 +20,7 @@ class DepthPass
     ~DepthPass(); /* = default; */
 
     void RegisterRenderable(const Entity& entity, const MeshRenderer& renderer);
-    void UnregisterRenderable(const Entity& entity);
+    void UnregisterRenderable(uint32_t entity_id);
 
     void Init();
     void Render();
@@ -35,7 +36,7 @@ class DepthPass
     std::vector<std::unique_ptr<MeshRenderData>> meshes_;
     bool debug_draw_shadow_bounds_;
     bool debug_draw_camera_bounds_;
-    Camera* current_camera_;
+    const CameraSnapshot* current_camera_;
 
     bool ShouldRun();
 
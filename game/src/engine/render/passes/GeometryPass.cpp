@@ -4,10 +4,12 @@
 
 #include "engine/core/debug/Assert.h"
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/core/gfx/Cubemap.h"
 #include "engine/core/gfx/ShaderProgram.h"
 #include "engine/render/Camera.h"
 #include "engine/render/MeshRenderer.h"
+#include "engine/render/RenderSnapshot.h"
 #include "engine/render/passes/depth/ShadowMap.h"
 #include "engine/scene/Entity.h"
 
@@ -28,7 +30,7 @@ struct BufferMeshLayout
 
 struct MeshRenderData
 {
-    std::vector<const Entity*> entities;
+    std::vector<uint32_t> entity_ids;
     std::vector<BufferMeshLayout> layout;
     VertexArray vertex_array;
     VertexBuffer vertex_buffer;
@@ -98,7 +100,7 @@ void GeometryPass::RegisterRenderable(const Entity& entity,
     {
         if (mesh_names == mesh->mesh_names)
         {
-            mesh->entities.push_back(&entity);
+            mesh->entity_ids.push_back(entity.GetId());
             return;
         }
     }
@@ -111,7 +113,7 @@ void GeometryPass::CreateBuffers(const Entity& entity,
                                  const MeshRenderer& renderer)
 {
     auto data = make_unique<MeshRenderData>(MeshRenderData{
-        .entities = {&entity},
+        .entity_ids = {entity.GetId()},
         .layout = {},
         .vertex_array = VertexArray(),
         .vertex_buffer = VertexBuffer(),
@@ -173,23 +175,22 @@ void GeometryPass::CreateBuffers(const Entity& entity,
     meshes_.push_back(std::move(data));
 }
 
-void GeometryPass::UnregisterRenderable(const Entity& entity)
+void GeometryPass::UnregisterRenderable(uint32_t entity_id)
 {
-    const uint32_t target_id = entity.GetId();
     auto meshes_iter = meshes_.begin();
 
     while (meshes_iter != meshes_.end())
     {
         MeshRenderData& mesh = *meshes_iter->get();
-        auto entity_iter = mesh.entities.begin();
+        auto entity_iter = mesh.entity_ids.begin();
 
-        while (entity_iter != mesh.entities.end())
+        while (entity_iter != mesh.entity_ids.end())
         {
-            if ((*entity_iter)->GetId() == target_id)
+            if (*entity_iter == entity_id)
             {
-                mesh.entities.erase(entity_iter);
+                mesh.entity_ids.erase(entity_iter);
 
-                if (mesh.entities.size() == 0)
+                if (mesh.entity_ids.size() == 0)
                 {
                     meshes_.erase(meshes_iter);
                 }
@@ -300,6 +301,8 @@ void GeometryPass::InitResolveFbo()
 
 void GeometryPass::Render()
 {
+    PROFILE_SCOPE("GeometryPass::Render");
+
     debug_num_draw_calls_ = 0;
 
     CheckScreenResize();
@@ -318,26 +321,24 @@ void GeometryPass::Render()
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     // Determine which camera to render
-    if (render_data_.cameras.size() > 0)
+    if (render_data_.snapshot && render_data_.snapshot->cameras.size() > 0)
     {
-        Camera* main_camera = nullptr;
+        const CameraSnapshot* main_camera = nullptr;
 
-        for (size_t i = 0; i < render_data_.cameras.size(); i++)
+        for (const CameraSnapshot& camera : render_data_.snapshot->cameras)
         {
-            Camera* camera = render_data_.cameras[i];
-
-            if (camera->GetType() == CameraType::kDisabled)
+            if (camera.type == CameraType::kDisabled)
             {
                 // Ignore disabled cameras
             }
-            else if (camera->GetType() == CameraType::kNormal)
+            else if (camera.type == CameraType::kNormal)
             {
-                main_camera = camera;
+                main_camera = &camera;
             }
-            else if (camera->GetType() == CameraType::kDebug)
+            else if (camera.type == CameraType::kDebug)
             {
                 // First debug camera always gets priority
-                main_camera = camera;
+                main_camera = &camera;
                 break;
             }
         }
@@ -385,8 +386,8 @@ void GeometryPass::RenderDebugGui()
         for (size_t i = 0; i < meshes_.size(); i++)
         {
             const MeshRenderData* mesh = meshes_[i].get();
-            ImGui::BulletText("%zu entities - %zu bytes", mesh->entities.size(),
-                              mesh->buffer_size);
+            ImGui::BulletText("%zu entities - %zu bytes",
+                              mesh->entity_ids.size(), mesh->buffer_size);
         }
     }
 }
@@ -404,15 +405,13 @@ void GeometryPass::ResolveMultisampledTarget()
                       GL_COLOR_BUFFER_BIT, GL_NEAREST);
 }
 
-CameraView GeometryPass::PrepareCameraView(Camera& camera)
+CameraView GeometryPass::PrepareCameraView(const CameraSnapshot& camera)
 {
     CameraView view = {};
 
-    view.camera_transform = &camera.GetEntity().GetComponent<Transform>();
-    view.pos = view.camera_transform->GetPosition();
-
-    view.view_matrix = camera.GetViewMatrix();
-    view.proj_matrix = camera.GetProjectionMatrix();
+    view.pos = camera.pos;
+    view.view_matrix = camera.view_matrix;
+    view.proj_matrix = camera.proj_matrix;
     view.view_proj_matrix = view.proj_matrix * view.view_matrix;
 
     return view;
@@ -494,33 +493,39 @@ void GeometryPass::RenderMeshes(const CameraView& camera)
     shader_.SetUniform("uLight.diffuse", vec3(0.5f, 0.5f, 0.5f));
 
     // Render each object for each entity
+    const auto& renderables = render_data_.snapshot->renderables;
+
     for (const auto& obj : meshes_)
     {
         obj->vertex_array.Bind();
 
-        for (const auto entity : obj->entities)
+        for (const uint32_t entity_id : obj->entity_ids)
         {
-            const MeshRenderer& renderer = entity->GetComponent<MeshRenderer>();
-            const Transform& transform = entity->GetComponent<Transform>();
+            // Registered after the snapshot was taken, or destroyed since
+            auto renderable_iter = renderables.find(entity_id);
+            if (renderable_iter == renderables.end())
+            {
+                continue;
+            }
+
+            const RenderableSnapshot& renderable = renderable_iter->second;
+
+            // Meshes were swapped this tick, buffers catch up next frame
+            if (renderable.materials.size() != obj->layout.size())
+            {
+                continue;
+            }
 
-            const mat4& model_matrix = transform.GetModelMatrix();
             // Since we're passing normals in world space, the view matrix =
             // identity, so we don't need to multiply by it
-            const mat4 normal_matrix = transform.GetNormalMatrix();
-
-            // Vert shader vars
-            shader_.SetUniform("uModelMatrix", model_matrix);
-            shader_.SetUniform("uNormalMatrix", normal_matrix);
+            shader_.SetUniform("uModelMatrix", renderable.model_matrix);
+            shader_.SetUniform("uNormalMatrix", renderable.normal_matrix);
 
             // Draw all meshes that are part of this object
-            const auto& meshes = renderer.GetMeshes();
-            ASSERT_MSG(meshes.size() == obj->layout.size(),
-                       "Mesh data out of sync with renderer");
-
-            for (size_t i = 0; i < meshes.size(); i++)
+            for (size_t i = 0; i < renderable.materials.size(); i++)
             {
                 const MaterialProperties& material_properties =
-                    meshes[i].material_properties;
+                    renderable.materials[i];
 
                 if (material_properties.albedo_texture)
                 {
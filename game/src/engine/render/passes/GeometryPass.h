@@ -12,6 +12,7 @@
 #include "engine/render/RenderBuffers.h"
 #include "engine/render/SceneRenderData.h"
 
+struct CameraSnapshot;
 struct CameraView;
 struct MeshRenderData;
 class Cubemap;
@@ -25,7 +26,7 @@ class GeometryPass
     ~GeometryPass(); /* = default; (in cpp) */
 
     void RegisterRenderable(const Entity& entity, const MeshRenderer& renderer);
-    void UnregisterRenderable(const Entity& entity);
+    void UnregisterRenderable(uint32_t entity_id);
 
     void Init();
     void Render();
@@ -64,7 +65,7 @@ class GeometryPass
     void InitResolveFbo();
     void ResolveMultisampledTarget();
     void CheckScreenResize();
-    CameraView PrepareCameraView(Camera& camera);
+    CameraView PrepareCameraView(const CameraSnapshot& camera);
     void RenderMeshes(const CameraView& camera);
     void RenderDebugDrawList(const CameraView& camera);
     void RenderSkybox(const CameraView& camera);
@@ -4,6 +4,7 @@
 
 #include <vector>
 
+#include "engine/core/debug/Profiler.h"
 #include "engine/core/gfx/Texture.h"
 
 using glm::vec2;
@@ -58,6 +59,8 @@ void PostProcessPass::Init()
 
 void PostProcessPass::Render()
 {
+    PROFILE_SCOPE("PostProcessPass::Render");
+
     // Render to default framebuffer
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glViewport(0, 0, render_data_.screen_size.x, render_data_.screen_size.y);
@@ -33,7 +33,7 @@ void Component::OnStart()
 
 void Component::OnDestroy()
 {
-    for (uint32_t sub_id : event_sub_ids_)
+    for (const EventBus::SubscriptionId& sub_id : event_sub_ids_)
     {
         GetEventBus().Unsubscribe(sub_id);
     }
@@ -62,7 +62,8 @@ const uint32_t& Component::GetId() const
     return id_;
 }
 
-void Component::ManageEventSub(uint32_t subscription_id)
+void Component::ManageEventSub(EventBus::SubscriptionId subscription_id)
 {
     event_sub_ids_.push_back(subscription_id);
+    GetEventBus().SetSubscriberName(subscription_id, GetName());
 }
\ No newline at end of file
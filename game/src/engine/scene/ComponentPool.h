@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <object_ptr.hpp>
+#include <vector>
+
+#include "engine/core/debug/Assert.h"
+#include "engine/scene/Component.h"
+
+// Type erased pool, so a Scene can own one pool per component type
+class IComponentPool
+{
+  public:
+    virtual ~IComponentPool() = default;
+
+    virtual void Destroy(Component& component) = 0;
+    virtual void ForEach(const std::function<void(Component&)>& function) = 0;
+
+    // Any live component, nullptr when empty
+    virtual Component* GetAny() = 0;
+    virtual size_t GetSize() const = 0;
+};
+
+/**
+ * Stores every component of one type in fixed size blocks, so iterating them
+ * walks contiguous memory instead of chasing a heap pointer per component.
+ * Blocks never move, so references handed out stay valid until the component
+ * is destroyed, and freed slots get reused by the next component created.
+ * Blocks come from the owning scene's memory resource
+ */
+template <class ComponentType>
+class ComponentPool final : public IComponentPool
+{
+  public:
+    // Roughly 16KB per block, but at most 64 slots so liveness fits in a word
+    static constexpr size_t kBlockSize =
+        std::clamp(size_t(16384) / sizeof(ComponentType), size_t(1),
+                   size_t(64));
+
+    ComponentPool(std::pmr::memory_resource& memory)
+        : memory_(&memory),
+          blocks_{},
+          free_slots_{},
+          size_(0)
+    {
+    }
+
+    ~ComponentPool() override
+    {
+        for (auto& block : blocks_)
+        {
+            for (size_t i = 0; i < kBlockSize; i++)
+            {
+                if (block->alive.test(i))
+                {
+                    block->Get(i)->~ComponentType();
+                }
+            }
+
+            block->~Block();
+            memory_->deallocate(block, sizeof(Block), alignof(Block));
+        }
+    }
+
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    ComponentType& Create()
+    {
+        if (free_slots_.empty())
+        {
+            AddBlock();
+        }
+
+        const size_t slot = free_slots_.back();
+        free_slots_.pop_back();
+
+        Block& block = *blocks_[slot / kBlockSize];
+        const size_t index = slot % kBlockSize;
+
+        ComponentType* component = new (block.GetSlot(index)) ComponentType();
+        block.alive.set(index);
+        size_++;
+
+        return *component;
+    }
+
+    void Destroy(Component& component) override
+    {
+        ComponentType* target = static_cast<ComponentType*>(&component);
+        const std::byte* address = reinterpret_cast<const std::byte*>(target);
+        std::less<const std::byte*> less;
+
+        for (size_t i = 0; i < blocks_.size(); i++)
+        {
+            Block& block = *blocks_[i];
+
+            if (less(address, block.storage) ||
+                !less(address, block.storage + sizeof(block.storage)))
+            {
+                continue;
+            }
+
+            const size_t index =
+                static_cast<size_t>(address - block.storage) /
+                sizeof(ComponentType);
+            ASSERT_MSG(block.alive.test(index), "Component must be alive");
+
+            target->~ComponentType();
+            block.alive.reset(index);
+            free_slots_.push_back(i * kBlockSize + index);
+            size_--;
+            return;
+        }
+
+        ASSERT_ALWAYS("Component does not belong to this pool");
+    }
+
+    /**
+     * Calls function on every live component in memory order. Components
+     * created during iteration may or may not be visited
+     */
+    template <class Function>
+    void ForEachComponent(Function&& function)
+    {
+        // Indices rather than iterators, the function may add blocks
+        for (size_t i = 0; i < blocks_.size(); i++)
+        {
+            for (size_t j = 0; j < kBlockSize; j++)
+            {
+                if (blocks_[i]->alive.test(j))
+                {
+                    function(*blocks_[i]->Get(j));
+                }
+            }
+        }
+    }
+
+    void ForEach(const std::function<void(Component&)>& function) override
+    {
+        ForEachComponent([&function](ComponentType& component)
+                         { function(component); });
+    }
+
+    Component* GetAny() override
+    {
+        for (auto& block : blocks_)
+        {
+            for (size_t i = 0; i < kBlockSize; i++)
+            {
+                if (block->alive.test(i))
+                {
+                    return block->Get(i);
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    size_t GetSize() const override
+    {
+        return size_;
+    }
+
+  private:
+    struct Block
+    {
+        alignas(ComponentType) std::byte storage[sizeof(ComponentType) *
+                                                 kBlockSize];
+        std::bitset<kBlockSize> alive;
+
+        void* GetSlot(size_t index)
+        {
+            return storage + index * sizeof(ComponentType);
+        }
+
+        // Only valid for live slots
+        ComponentType* Get(size_t index)
+        {
+            return std::launder(
+                reinterpret_cast<ComponentType*>(GetSlot(index)));
+        }
+    };
+
+    jss::object_ptr<std::pmr::memory_resource> memory_;
+    std::vector<Block*> blocks_;
+    std::vector<size_t> free_slots_;
+    size_t size_;
+
+    void AddBlock()
+    {
+        const size_t first_slot = blocks_.size() * kBlockSize;
+        void* memory = memory_->allocate(sizeof(Block), alignof(Block));
+        blocks_.push_back(new (memory) Block());
+
+        // Reversed, so slots are handed out front to back
+        for (size_t i = kBlockSize; i > 0; i--)
+        {
+            free_slots_.push_back(first_slot + i - 1);
+        }
+    }
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <memory>
+#include <memory_resource>
+#include <object_ptr.hpp>
+#include <type_traits>
+
+#include "engine/scene/ComponentPool.h"
+#include "engine/scene/ComponentTypeId.h"
+
+/**
+ * Owns one ComponentPool per component type for a Scene. Entities only keep
+ * references into the pools, so components of a type sit next to each other
+ */
+class ComponentStorage
+{
+  public:
+    ComponentStorage(std::pmr::memory_resource& memory) : memory_(&memory)
+    {
+    }
+
+    ComponentStorage(const ComponentStorage&) = delete;
+    ComponentStorage& operator=(const ComponentStorage&) = delete;
+
+    template <class ComponentType>
+        requires std::derived_from<ComponentType, Component>
+    ComponentPool<ComponentType>& GetPool()
+    {
+        auto& pool = pools_[GetComponentTypeId<ComponentType>()];
+
+        if (!pool)
+        {
+            pool = std::make_unique<ComponentPool<ComponentType>>(*memory_);
+        }
+
+        return static_cast<ComponentPool<ComponentType>&>(*pool);
+    }
+
+    /**
+     * Calls function on every live component of the given type. Base types
+     * like RigidBodyComponent visit the pools of all their derived types,
+     * final types go straight to their own pool
+     */
+    template <class ComponentType, class Function>
+        requires std::derived_from<ComponentType, Component>
+    void ForEach(Function&& function)
+    {
+        if constexpr (std::is_final_v<ComponentType>)
+        {
+            auto& pool = pools_[GetComponentTypeId<ComponentType>()];
+
+            if (pool)
+            {
+                static_cast<ComponentPool<ComponentType>&>(*pool)
+                    .ForEachComponent(function);
+            }
+        }
+        else
+        {
+            for (auto& pool : pools_)
+            {
+                if (!pool)
+                {
+                    continue;
+                }
+
+                // Every component in a pool has the same type, so checking
+                // one is enough
+                Component* sample = pool->GetAny();
+
+                if (!sample || !dynamic_cast<ComponentType*>(sample))
+                {
+                    continue;
+                }
+
+                pool->ForEach(
+                    [&function](Component& component)
+                    { function(static_cast<ComponentType&>(component)); });
+            }
+        }
+    }
+
+    // Frees every pool, and with it all of their blocks
+    void Clear()
+    {
+        for (auto& pool : pools_)
+        {
+            pool.reset();
+        }
+    }
+
+  private:
+    jss::object_ptr<std::pmr::memory_resource> memory_;
+
+    // Indexed by ComponentTypeId
+    std::array<std::unique_ptr<IComponentPool>, kMaxComponentTypes> pools_;
+};
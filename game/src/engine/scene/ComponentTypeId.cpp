@@ -0,0 +1,42 @@
+#include "engine/scene/ComponentTypeId.h"
+
+#include <atomic>
+#include <cstdlib>
+
+#include "engine/core/debug/Log.h"
+
+static std::atomic<ComponentTypeId> kNextComponentTypeId = 0;
+
+// One bit per type, entities may be added from several threads at once
+static_assert(kMaxComponentTypes <= 64);
+static std::atomic<uint64_t> kUpdatedComponentTypes = 0;
+
+ComponentTypeId NextComponentTypeId()
+{
+    const ComponentTypeId id =
+        kNextComponentTypeId.fetch_add(1, std::memory_order_relaxed);
+
+    // Entities index fixed size tables with the id, so carrying on in a
+    // release build would silently corrupt them
+    if (id >= kMaxComponentTypes)
+    {
+        debug::LogError(
+            "More than {} component types, raise kMaxComponentTypes",
+            kMaxComponentTypes);
+        std::abort();
+    }
+
+    return id;
+}
+
+void MarkComponentTypeUpdated(ComponentTypeId type)
+{
+    kUpdatedComponentTypes.fetch_or(uint64_t(1) << type,
+                                    std::memory_order_relaxed);
+}
+
+bool IsComponentTypeUpdated(ComponentTypeId type)
+{
+    return (kUpdatedComponentTypes.load(std::memory_order_relaxed) >> type) &
+           1;
+}
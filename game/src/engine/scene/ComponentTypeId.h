@@ -0,0 +1,41 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#include "engine/core/debug/Assert.h"
+
+using ComponentTypeId = uint32_t;
+
+// Upper bound on distinct component types, sizes each entity's lookup table
+static constexpr size_t kMaxComponentTypes = 64;
+
+// One bit per ComponentTypeId
+using ComponentMask = std::bitset<kMaxComponentTypes>;
+
+// Hands out ids in order of first use, so they stay dense
+ComponentTypeId NextComponentTypeId();
+
+// Component types some ComponentUpdateService system updates every tick
+void MarkComponentTypeUpdated(ComponentTypeId type);
+bool IsComponentTypeUpdated(ComponentTypeId type);
+
+/**
+ * Dense id for a component type, assigned the first time the type is used.
+ * Unlike std::type_index it can index straight into an array
+ */
+template <class ComponentType>
+ComponentTypeId GetComponentTypeId()
+{
+    static const ComponentTypeId id = NextComponentTypeId();
+    return id;
+}
+
+template <class... ComponentTypes>
+ComponentMask MakeComponentMask()
+{
+    ComponentMask mask;
+    (mask.set(GetComponentTypeId<ComponentTypes>()), ...);
+    return mask;
+}
@@ -1,17 +1,17 @@
 #include "engine/scene/ComponentUpdateService.h"
 
-#include <GLFW/glfw3.h>
-
-#include <chrono>
-
+#include "engine/App.h"
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/scene/OnUpdateEvent.h"
 #include "engine/service/ServiceProvider.h"
 
 using std::make_unique;
 using std::string_view;
 
-ComponentUpdateService::ComponentUpdateService() : last_frame_()
+ComponentUpdateService::ComponentUpdateService()
+    : active_scene_(nullptr),
+      systems_{}
 {
 }
 
@@ -23,16 +23,43 @@ void ComponentUpdateService::OnStart(ServiceProvider& service_provider)
 {
 }
 
-void ComponentUpdateService::OnUpdate()
+void ComponentUpdateService::OnSceneLoaded(Scene& scene)
 {
-    const Timestep current_frame = Timestep::Seconds(glfwGetTime());
-    const Timestep delta_time = current_frame - last_frame_;
-    last_frame_ = current_frame;
+    active_scene_ = &scene;
+}
 
+void ComponentUpdateService::OnSceneUnloaded(Scene& scene)
+{
+    active_scene_ = nullptr;
+}
+
+void ComponentUpdateService::OnUpdate(const FrameContext& frame)
+{
     auto event_data = make_unique<OnUpdateEvent>();
-    event_data->delta_time = delta_time;
+    event_data->delta_time = frame.delta_time;
 
     GetEventBus().Publish<OnUpdateEvent>(event_data.get());
+
+    if (!active_scene_)
+    {
+        return;
+    }
+
+    {
+        // Systems query the positions physics just wrote this tick
+        PROFILE_SCOPE("SpatialIndex");
+        active_scene_->GetSpatialIndex().Update();
+    }
+
+    for (const System& system : systems_)
+    {
+        PROFILE_SCOPE(system.name);
+        system.update(*active_scene_, frame.delta_time);
+    }
+
+    // Children follow whatever physics and the systems above moved this tick
+    PROFILE_SCOPE("TransformHierarchy");
+    active_scene_->GetTransformHierarchy().Update();
 }
 
 void ComponentUpdateService::OnCleanup()
@@ -42,4 +69,15 @@ void ComponentUpdateService::OnCleanup()
 string_view ComponentUpdateService::GetName() const
 {
     return "ComponentUpdateService";
+}
+
+ServiceAccess ComponentUpdateService::GetAccess() const
+{
+    // Components use nearly every other service from their updates, so this
+    // only leaves input alone
+    return ServiceAccess{
+        .reads = service_access::kAll,
+        .writes = service_access::kAll & ~service_access::kInput,
+        .main_thread = true,
+        .phase = UpdatePhase::kSimulation};
 }
\ No newline at end of file
@@ -1,20 +1,103 @@
 #pragma once
 
-#include "engine/core/math/Timestep.h"
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <object_ptr.hpp>
+#include <string_view>
+#include <vector>
+
+#include "engine/core/debug/TypeName.h"
+#include "engine/scene/Scene.h"
 #include "engine/service/Service.h"
 
+// Where a component system runs within a tick, earlier stages go first
+enum class SystemStage : uint8_t
+{
+    // Controllers deciding what their entity does this tick
+    kInput,
+
+    // Vehicles, weapons, player state and pickups acting on it
+    kGameplay,
+
+    // Cameras and audio following whatever moved
+    kPresentation,
+};
+
+// Components a system can update, either one at a time or as a whole batch
+template <class ComponentType>
+concept UpdatableComponent =
+    std::derived_from<ComponentType, Component> &&
+    (requires(ComponentType& component, const Timestep& step) {
+        component.OnUpdate(step);
+    } || requires(Scene& scene, const Timestep& step) {
+        ComponentType::UpdateAll(scene, step);
+    });
+
+/**
+ * Updates components once per simulation tick. Each registered component type
+ * is a system that walks every instance in the active scene in one loop,
+ * calling OnUpdate directly instead of through a virtual event handler per
+ * instance. A type can define a static UpdateAll(Scene&, const Timestep&) to
+ * replace that loop with its own batched one.
+ *
+ * Systems run by stage, then in the order they were registered. OnUpdateEvent
+ * is still published first, for services that listen to it, and the scene's
+ * TransformHierarchy is updated last
+ */
 class ComponentUpdateService final : public Service
 {
   public:
     ComponentUpdateService();
 
+    template <class ComponentType>
+        requires UpdatableComponent<ComponentType>
+    void RegisterSystem(SystemStage stage)
+    {
+        MarkComponentTypeUpdated(GetComponentTypeId<ComponentType>());
+        systems_.push_back(System{.name = debug::GetTypeName<ComponentType>(),
+                                  .stage = stage,
+                                  .update = &UpdateSystem<ComponentType>});
+
+        std::stable_sort(systems_.begin(), systems_.end(),
+                         [](const System& a, const System& b)
+                         { return a.stage < b.stage; });
+    }
+
     // From Service
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
-    void OnUpdate() override;
+    void OnSceneLoaded(Scene& scene) override;
+    void OnSceneUnloaded(Scene& scene) override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
   private:
-    Timestep last_frame_;
+    struct System
+    {
+        std::string_view name;
+        SystemStage stage;
+        void (*update)(Scene& scene, const Timestep& delta_time);
+    };
+
+    jss::object_ptr<Scene> active_scene_;
+    std::vector<System> systems_;
+
+    template <class ComponentType>
+    static void UpdateSystem(Scene& scene, const Timestep& delta_time)
+    {
+        if constexpr (requires { ComponentType::UpdateAll(scene, delta_time); })
+        {
+            ComponentType::UpdateAll(scene, delta_time);
+        }
+        else
+        {
+            // Final types go straight to their pool, and the call isn't virtual
+            scene.ForEachComponent<ComponentType>(
+                [&delta_time](ComponentType& component)
+                { component.OnUpdate(delta_time); });
+        }
+    }
 };
@@ -1,5 +1,9 @@
 #include "engine/scene/Entity.h"
 
+#include <cstdlib>
+
+#include "engine/core/debug/Log.h"
+#include "engine/core/jobs/JobSystem.h"
 #include "engine/scene/Scene.h"
 
 using jss::object_ptr;
@@ -7,22 +11,40 @@ using std::string;
 using std::unique_ptr;
 using std::vector;
 
+// Only the thread running the scenes creates entities, see Scene::AddEntity
 static uint32_t kNextEntityId = 0;
 
-Entity::Entity(const std::string& name)
+Entity::Entity(const std::string& name, std::pmr::memory_resource* memory)
     : id_(kNextEntityId),
+      handle_{},
       name_(name),
       scene_(nullptr),
-      components_{}
+      component_storage_(nullptr),
+      components_(memory),
+      component_mask_{},
+      component_index_{}
 {
     kNextEntityId += 1;
 }
 
-vector<Entity::ComponentEntry>& Entity::GetComponents()
+Entity::~Entity()
+{
+    for (auto& entry : components_)
+    {
+        entry.pool->Destroy(*entry.component);
+    }
+}
+
+std::pmr::vector<Entity::ComponentEntry>& Entity::GetComponents()
 {
     return components_;
 }
 
+const ComponentMask& Entity::GetComponentMask() const
+{
+    return component_mask_;
+}
+
 void Entity::SetName(const string& name)
 {
     name_ = name;
@@ -31,7 +53,7 @@ void Entity::SetName(const string& name)
 void Entity::Destroy()
 {
     ASSERT_MSG(scene_, "Entity must have valid scene");
-    scene_->DestroyEntity(id_);
+    scene_->DestroyEntity(handle_);
 }
 
 void Entity::OnDestroy()
@@ -42,9 +64,17 @@ void Entity::OnDestroy()
     }
 }
 
-void Entity::SetScene(object_ptr<Scene> scene)
+void Entity::SetScene(object_ptr<Scene> scene, EntityHandle handle)
 {
     scene_ = scene;
+    handle_ = handle;
+    component_storage_ = scene ? &scene->GetComponentStorage() : nullptr;
+}
+
+void Entity::AssertSceneThread() const
+{
+    ASSERT_MSG(!JobSystem::IsAnyWorkerThread(),
+               "Components can't be added from a job worker");
 }
 
 void Entity::InitComponent(Component& component)
@@ -55,12 +85,35 @@ void Entity::InitComponent(Component& component)
     component.Init(initializer);
 }
 
+void Entity::OnComponentsChanged()
+{
+    scene_->UpdateViews(*this);
+}
+
 const uint32_t& Entity::GetId() const
 {
     return id_;
 }
 
+EntityHandle Entity::GetHandle() const
+{
+    return handle_;
+}
+
 const string& Entity::GetName() const
 {
     return name_;
 }
+
+Scene& Entity::GetScene() const
+{
+    ASSERT_MSG(scene_, "Entity must have valid scene");
+    return *scene_;
+}
+
+void Entity::OnMissingComponent(const char* type_name) const
+{
+    debug::LogError("Entity '{}' does not have a {} component", name_,
+                    type_name);
+    std::abort();
+}
@@ -1,14 +1,20 @@
 #pragma once
 
+#include <array>
 #include <concepts>
 #include <memory>
+#include <memory_resource>
 #include <object_ptr.hpp>
 #include <string>
-#include <typeindex>
 #include <vector>
 
 #include "engine/core/debug/Assert.h"
+#include "engine/core/debug/TypeName.h"
+#include "engine/core/math/Timestep.h"
 #include "engine/scene/Component.h"
+#include "engine/scene/ComponentStorage.h"
+#include "engine/scene/ComponentTypeId.h"
+#include "engine/scene/EntityHandle.h"
 
 class Scene;
 
@@ -17,33 +23,61 @@ class Entity
   public:
     struct ComponentEntry
     {
-        std::type_index type;
-        std::unique_ptr<Component> component;
+        ComponentTypeId type;
+        jss::object_ptr<Component> component;
+        jss::object_ptr<IComponentPool> pool;
     };
 
-    Entity(const std::string& name = "Entity");
+    Entity(
+        const std::string& name = "Entity",
+        std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    ~Entity();
+
+    // Owns its components, copying would free them twice
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
 
     template <class ComponentType>
         requires std::derived_from<ComponentType, Component>
     ComponentType& AddComponent()
     {
         ASSERT_MSG(scene_, "Entity must belong to a Scene to add a Component");
+        AssertSceneThread();
         ASSERT_MSG(
             !HasComponent<ComponentType>(),
             "Cannot have two Components of the same type on the same Entity");
 
-        ComponentEntry entry{.type = std::type_index(typeid(ComponentType)),
-                             .component = std::make_unique<ComponentType>()};
+        const ComponentTypeId type = GetComponentTypeId<ComponentType>();
+
+        // Nothing else calls OnUpdate, so a type without a system would just
+        // silently stop updating
+        if constexpr (requires(ComponentType& component, const Timestep& step) {
+                          component.OnUpdate(step);
+                      } || requires(Scene& scene, const Timestep& step) {
+                          ComponentType::UpdateAll(scene, step);
+                      })
+        {
+            ASSERT_MSG(IsComponentTypeUpdated(type),
+                       "Component type has no system, register it with "
+                       "ComponentUpdateService::RegisterSystem");
+        }
+
+        // Lives in the scene's pool for this type, next to its siblings
+        auto& pool = component_storage_->GetPool<ComponentType>();
+        ComponentType& component_ref = pool.Create();
+
+        ComponentEntry entry{
+            .type = type, .component = &component_ref, .pool = &pool};
 
-        ComponentType& component_ref =
-            static_cast<ComponentType&>(*entry.component);
         InitComponent(component_ref);
 
+        // Init may add other components, so the index is taken afterwards
+        component_mask_.set(type);
+        component_index_[type] = static_cast<uint8_t>(components_.size());
         components_.push_back(std::move(entry));
+        OnComponentsChanged();
 
-        // Returning the ref here is okay despite the move above, since it's a
-        // ref to a ComponentType allocated on the heap. Moving the pointer does
-        // not change it's address, therefore this is safe
+        // Pool slots never move, so the ref stays valid until it's destroyed
         return component_ref;
     }
 
@@ -51,56 +85,76 @@ class Entity
         requires std::derived_from<ComponentType, Component>
     ComponentType& GetComponent() const
     {
-        std::type_index key = typeid(ComponentType);
+        ComponentType* component = TryGetComponent<ComponentType>();
 
-        for (auto& entry : components_)
+        // This should never happen at runtime, so crash loudly in every build
+        if (!component)
         {
-            if (entry.type == key)
-            {
-                return static_cast<ComponentType&>(*entry.component);
-            }
+            OnMissingComponent(debug::GetTypeName<ComponentType>());
         }
 
-        // This should never happen at runtime, so throw error and crash
-        throw new std::exception("Component does not exist on Entity");
+        return *component;
     }
 
-    // clang-format off
-    // clang-format keeps trying to put the return type on a different line...
-
+    // Returns nullptr if the entity doesn't have the component
     template <class ComponentType>
         requires std::derived_from<ComponentType, Component>
-    bool HasComponent()
+    ComponentType* TryGetComponent() const
     {
-        // clang-format on
-        std::type_index key = typeid(ComponentType);
+        const ComponentTypeId type = GetComponentTypeId<ComponentType>();
 
-        for (auto& entry : components_)
+        if (!component_mask_.test(type))
         {
-            if (entry.type == key)
-            {
-                return true;
-            }
+            return nullptr;
         }
 
-        return false;
+        return static_cast<ComponentType*>(
+            components_[component_index_[type]].component.get());
+    }
+
+    // clang-format off
+    // clang-format keeps trying to put the return type on a different line...
+
+    template <class ComponentType>
+        requires std::derived_from<ComponentType, Component>
+    bool HasComponent() const
+    {
+        // clang-format on
+        return component_mask_.test(GetComponentTypeId<ComponentType>());
     }
 
-    std::vector<ComponentEntry>& GetComponents();
-    void SetScene(jss::object_ptr<Scene> scene);
+    std::pmr::vector<ComponentEntry>& GetComponents();
+    const ComponentMask& GetComponentMask() const;
+    void SetScene(jss::object_ptr<Scene> scene, EntityHandle handle);
     void SetName(const std::string& name);
+
+    // Queues the entity to be destroyed at the end of the frame
     void Destroy();
     void OnDestroy();
 
+    // Never reused, unlike the handle, so it's safe as a key across scenes
     const uint32_t& GetId() const;
+    EntityHandle GetHandle() const;
     const std::string& GetName() const;
+    Scene& GetScene() const;
 
   protected:
+    // Components come from the scene's pools, see Scene::AddEntity
+    void AssertSceneThread() const;
     void InitComponent(Component& component);
+    void OnComponentsChanged();
+
+    [[noreturn]] void OnMissingComponent(const char* type_name) const;
 
   private:
     uint32_t id_;
+    EntityHandle handle_;
     std::string name_;
     jss::object_ptr<Scene> scene_;
-    std::vector<ComponentEntry> components_;
+    jss::object_ptr<ComponentStorage> component_storage_;
+    std::pmr::vector<ComponentEntry> components_;
+
+    // Which component types are present, and where they are in components_
+    ComponentMask component_mask_;
+    std::array<uint8_t, kMaxComponentTypes> component_index_;
 };
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Refers to an entity in a Scene without owning it. Packs the entity's slot
+ * index with a generation that changes every time the slot is reused, so a
+ * handle to a destroyed entity never resolves to the one that replaced it
+ */
+struct EntityHandle
+{
+    static constexpr uint32_t kIndexBits = 20;
+    static constexpr uint32_t kIndexMask = (1u << kIndexBits) - 1;
+
+    // Generations wrap before reaching this, so it only appears in kInvalid
+    static constexpr uint32_t kMaxGeneration = ~0u >> kIndexBits;
+    static constexpr uint32_t kInvalid = ~0u;
+
+    uint32_t value = kInvalid;
+
+    static EntityHandle Create(uint32_t index, uint32_t generation)
+    {
+        return EntityHandle{.value = (generation << kIndexBits) | index};
+    }
+
+    uint32_t GetIndex() const
+    {
+        return value & kIndexMask;
+    }
+
+    uint32_t GetGeneration() const
+    {
+        return value >> kIndexBits;
+    }
+
+    bool IsValid() const
+    {
+        return value != kInvalid;
+    }
+
+    bool operator==(const EntityHandle& other) const = default;
+};
@@ -1,49 +1,181 @@
 #include "engine/scene/Scene.h"
 
+#include <algorithm>
+
+#include "engine/core/jobs/JobSystem.h"
 #include "engine/scene/Entity.h"
 
-using std::make_unique;
 using std::string;
-using std::unique_ptr;
 using std::vector;
 
+// Component blocks are up to ~16KB, anything bigger goes straight upstream
+static constexpr size_t kLargestPooledAllocation = 32 * 1024;
+
 Scene::Scene(const string& name, ServiceProvider& service_provider)
     : name_(name),
       active_(false),
+      memory_(std::pmr::pool_options{
+          .max_blocks_per_chunk = 0,
+          .largest_required_pool_block = kLargestPooledAllocation}),
+      component_storage_(memory_),
+      transform_hierarchy_{},
+      spatial_index_{},
       entities_{},
+      slots_{},
+      free_slots_{},
+      views_{},
+      views_mutex_{},
+      pending_destroy_{},
+      pending_destroy_mutex_{},
       service_provider_(service_provider),
       event_bus_()
 {
 }
 
-void Scene::DestroyEntity(uint32_t id)
+Scene::~Scene()
+{
+    DeleteEntities();
+}
+
+Entity& Scene::AddEntity(const string& name)
+{
+    ASSERT_MSG(!JobSystem::IsAnyWorkerThread(),
+               "Entities can't be added from a job worker");
+
+    uint32_t index;
+
+    if (!free_slots_.empty())
+    {
+        index = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    else
+    {
+        ASSERT_MSG(slots_.size() < EntityHandle::kIndexMask,
+                   "Too many entities for an EntityHandle");
+
+        index = static_cast<uint32_t>(slots_.size());
+        slots_.push_back(EntitySlot{.generation = 0, .dense_index = 0});
+    }
+
+    EntitySlot& slot = slots_[index];
+    slot.dense_index = static_cast<uint32_t>(entities_.size());
+
+    std::pmr::polymorphic_allocator<Entity> allocator(&memory_);
+    Entity* entity = allocator.new_object<Entity>(name, &memory_);
+    entity->SetScene(this, EntityHandle::Create(index, slot.generation));
+    entities_.push_back(entity);
+
+    return *entities_.back();
+}
+
+void Scene::ReserveEntities(size_t count)
+{
+    const size_t required = entities_.size() + count;
+
+    // Still grows geometrically, so reserving many small batches stays linear
+    if (required > entities_.capacity())
+    {
+        const size_t capacity = std::max(required, entities_.capacity() * 2);
+        entities_.reserve(capacity);
+        slots_.reserve(capacity);
+    }
+}
+
+void Scene::DestroyEntity(EntityHandle handle)
+{
+    ASSERT_MSG(IsAlive(handle), "Entity does not exist");
+
+    std::lock_guard lock(pending_destroy_mutex_);
+    pending_destroy_.push_back(handle);
+}
+
+void Scene::FlushDestroyedEntities()
 {
-    auto iter = entities_.begin();
+    vector<EntityHandle> pending;
 
-    while (iter != entities_.end())
+    // OnDestroy can queue more entities, keep going until nothing is left
+    while (true)
     {
-        Entity* entity = iter->get();
+        {
+            std::lock_guard lock(pending_destroy_mutex_);
+            pending.swap(pending_destroy_);
+        }
 
-        if (entity->GetId() == id)
+        if (pending.empty())
         {
-            entity->OnDestroy();
-            entities_.erase(iter);
             return;
         }
 
-        iter++;
+        for (EntityHandle handle : pending)
+        {
+            Entity* entity = GetEntity(handle);
+
+            // Already gone if it was queued twice
+            if (!entity)
+            {
+                continue;
+            }
+
+            entity->OnDestroy();
+            RemoveEntity(handle);
+        }
+
+        pending.clear();
+    }
+}
+
+Entity* Scene::GetEntity(EntityHandle handle)
+{
+    if (!IsAlive(handle))
+    {
+        return nullptr;
     }
 
-    ASSERT_ALWAYS("Entity does not exist");
+    return entities_[slots_[handle.GetIndex()].dense_index];
 }
 
-Entity& Scene::AddEntity(const string& name)
+bool Scene::IsAlive(EntityHandle handle) const
 {
-    auto entity = make_unique<Entity>(name);
-    entity->SetScene(this);
-    entities_.push_back(std::move(entity));
+    // Freeing a slot bumps its generation, so only live handles match
+    return handle.IsValid() && handle.GetIndex() < slots_.size() &&
+           slots_[handle.GetIndex()].generation == handle.GetGeneration();
+}
 
-    return *entities_.back();
+void Scene::RemoveEntity(EntityHandle handle)
+{
+    const uint32_t dense_index = slots_[handle.GetIndex()].dense_index;
+    Entity* entity = entities_[dense_index];
+
+    {
+        std::lock_guard lock(views_mutex_);
+
+        for (auto& view : views_)
+        {
+            view->Remove(*entity);
+        }
+    }
+
+    // Move the last entity into the gap instead of shifting everything down
+    if (dense_index != entities_.size() - 1)
+    {
+        std::swap(entities_[dense_index], entities_.back());
+
+        const EntityHandle moved = entities_[dense_index]->GetHandle();
+        slots_[moved.GetIndex()].dense_index = dense_index;
+    }
+
+    entities_.pop_back();
+    FreeSlot(handle.GetIndex());
+
+    std::pmr::polymorphic_allocator<Entity>(&memory_).delete_object(entity);
+}
+
+void Scene::FreeSlot(uint32_t index)
+{
+    EntitySlot& slot = slots_[index];
+    slot.generation = (slot.generation + 1) % EntityHandle::kMaxGeneration;
+    free_slots_.push_back(index);
 }
 
 ComponentInitializer Scene::CreateComponentInitializer(Entity& entity)
@@ -71,15 +203,99 @@ void Scene::Unload()
         entity->OnDestroy();
     }
 
-    entities_.clear();
+    // Handles from before the unload must stay stale after a reload
+    for (auto& entity : entities_)
+    {
+        FreeSlot(entity->GetHandle().GetIndex());
+    }
+
+    {
+        std::lock_guard lock(views_mutex_);
+
+        for (auto& view : views_)
+        {
+            view->Clear();
+        }
+    }
+
+    DeleteEntities();
+    component_storage_.Clear();
+    transform_hierarchy_.Clear();
+    spatial_index_.Clear();
     event_bus_.ClearSubscribers();
+
+    // Everything was handed back above, so this frees whole chunks at once
+    memory_.release();
+
+    std::lock_guard lock(pending_destroy_mutex_);
+    pending_destroy_.clear();
+}
+
+void Scene::DeleteEntities()
+{
+    std::pmr::polymorphic_allocator<Entity> allocator(&memory_);
+
+    for (Entity* entity : entities_)
+    {
+        allocator.delete_object(entity);
+    }
+
+    entities_.clear();
 }
 
-vector<unique_ptr<Entity>>& Scene::GetEntities()
+void Scene::UpdateViews(Entity& entity)
+{
+    std::lock_guard lock(views_mutex_);
+
+    for (auto& view : views_)
+    {
+        view->Update(entity);
+    }
+}
+
+SceneViewCache& Scene::GetViewCache(const ComponentMask& mask)
+{
+    std::lock_guard lock(views_mutex_);
+
+    for (auto& view : views_)
+    {
+        if (view->GetMask() == mask)
+        {
+            return *view;
+        }
+    }
+
+    auto view = std::make_unique<SceneViewCache>(mask);
+
+    for (Entity* entity : entities_)
+    {
+        view->Update(*entity);
+    }
+
+    views_.push_back(std::move(view));
+    return *views_.back();
+}
+
+const vector<Entity*>& Scene::GetEntities() const
 {
     return entities_;
 }
 
+ComponentStorage& Scene::GetComponentStorage()
+{
+    return component_storage_;
+}
+
+TransformHierarchy& Scene::GetTransformHierarchy()
+{
+    return transform_hierarchy_;
+}
+
+SpatialIndex& Scene::GetSpatialIndex()
+{
+    return spatial_index_;
+}
+
 EventBus& Scene::GetEventBus()
 {
     return event_bus_;
@@ -1,33 +1,130 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "engine/scene/Entity.h"
+#include "engine/scene/EntityHandle.h"
+#include "engine/scene/SceneView.h"
+#include "engine/scene/SpatialIndex.h"
+#include "engine/scene/TransformHierarchy.h"
 #include "engine/service/ServiceProvider.h"
 
 class Scene
 {
   public:
     Scene(const std::string& name, ServiceProvider& service_provider);
+    ~Scene();
 
+    /**
+     * Scenes have a single writer. Entities and components are only added by
+     * the thread running the scene: the main thread, or the simulation thread
+     * during a tick. Never from a job worker, since their memory comes from an
+     * unsynchronized pool
+     */
     Entity& AddEntity(const std::string& name = "Entity");
-    void DestroyEntity(uint32_t id);
+
+    // Makes room up front when a batch of entities is about to be added
+    void ReserveEntities(size_t count);
+
+    /**
+     * Queues the entity to be destroyed by the next FlushDestroyedEntities,
+     * so it's safe to call in the middle of an update or event dispatch
+     */
+    void DestroyEntity(EntityHandle handle);
+    void FlushDestroyedEntities();
+
+    // Returns nullptr once the entity has been destroyed
+    Entity* GetEntity(EntityHandle handle);
+    bool IsAlive(EntityHandle handle) const;
+
     ComponentInitializer CreateComponentInitializer(Entity& entity);
     void Load();
     void Unload();
 
     EventBus& GetEventBus();
-    std::vector<std::unique_ptr<Entity>>& GetEntities();
+    ComponentStorage& GetComponentStorage();
+    TransformHierarchy& GetTransformHierarchy();
+    SpatialIndex& GetSpatialIndex();
+
+    /**
+     * Calls function(ComponentType&) on every live component of that type,
+     * in memory order. Prefer this over walking entities for per-frame work
+     */
+    template <class ComponentType, class Function>
+        requires std::derived_from<ComponentType, Component>
+    void ForEachComponent(Function&& function)
+    {
+        component_storage_.ForEach<ComponentType>(
+            std::forward<Function>(function));
+    }
+
+    /**
+     * Entities that have every one of ComponentTypes. The first query for a
+     * set of types scans the scene once, after that the view is kept up to
+     * date as components are added and entities destroyed
+     */
+    template <class... ComponentTypes>
+        requires(std::derived_from<ComponentTypes, Component> && ...)
+    SceneView<ComponentTypes...> View()
+    {
+        return SceneView<ComponentTypes...>(
+            GetViewCache(MakeComponentMask<ComponentTypes...>()));
+    }
+
+    // Called by an entity whenever its set of components changes
+    void UpdateViews(Entity& entity);
+
+    // Densely packed, destroying an entity moves the last one into its place
+    const std::vector<Entity*>& GetEntities() const;
 
     const std::string& GetName() const;
 
   private:
+    struct EntitySlot
+    {
+        uint32_t generation;
+        uint32_t dense_index;
+    };
+
     std::string name_;
     bool active_;
-    std::vector<std::unique_ptr<Entity>> entities_;
+
+    // Entities, their component lists and component pool blocks all live
+    // here, so Unload hands the memory back in one go. Declared first so it
+    // outlives everything allocated from it
+    std::pmr::unsynchronized_pool_resource memory_;
+
+    // Declared before the entities, which hand their components back to it
+    ComponentStorage component_storage_;
+    TransformHierarchy transform_hierarchy_;
+    SpatialIndex spatial_index_;
+    std::vector<Entity*> entities_;
+
+    // Slot map from handle index to entities_, reused slots bump generation
+    std::vector<EntitySlot> slots_;
+    std::vector<uint32_t> free_slots_;
+
+    // Only created on first use. Services querying in parallel can add a view
+    // while another adds components, so every access takes the lock
+    std::vector<std::unique_ptr<SceneViewCache>> views_;
+    std::mutex views_mutex_;
+
+    // Destroying only queues the entity, which is safe from any thread. The
+    // memory is handed back by FlushDestroyedEntities on the main thread
+    std::vector<EntityHandle> pending_destroy_;
+    std::mutex pending_destroy_mutex_;
+
     ServiceProvider& service_provider_;
     EventBus event_bus_;
+
+    void RemoveEntity(EntityHandle handle);
+    void FreeSlot(uint32_t index);
+    void DeleteEntities();
+    SceneViewCache& GetViewCache(const ComponentMask& mask);
 };
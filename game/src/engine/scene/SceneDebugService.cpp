@@ -1,7 +1,10 @@
 #include "engine/scene/SceneDebugService.h"
 
+#include <fmt/format.h>
 #include <imgui.h>
 
+#include <algorithm>
+#include <fstream>
 #include <string>
 
 #include "engine/App.h"
@@ -12,22 +15,24 @@
 using std::string_view;
 
 static constexpr float kComponentGuiIndent = 12.5f;
+static constexpr const char* kEventStatsPath = "event-stats.csv";
 
 void SceneDebugService::OnInit()
 {
     framerate_ = 0;
-    prev_time_ = 0.0;
+    fps_window_start_ = 0.0;
     frame_count_ = 0;
 }
 
 void SceneDebugService::OnStart(ServiceProvider& service_provider)
 {
     input_service_ = &service_provider.GetService<InputService>();
+    snapshot_service_ = service_provider.TryGetService<SceneSnapshotService>();
 
     GetEventBus().Subscribe<OnGuiEvent>(this);
 }
 
-void SceneDebugService::OnUpdate()
+void SceneDebugService::OnUpdate(const FrameContext& frame)
 {
     if (input_service_->IsKeyPressed(GLFW_KEY_F1))
     {
@@ -35,14 +40,14 @@ void SceneDebugService::OnUpdate()
         show_menu_ = !show_menu_;
     }
 
-    double cur_time = glfwGetTime();
+    const double cur_time = frame.elapsed_time.GetSeconds();
     frame_count_ += 1;
 
-    if (cur_time - prev_time_ >= 1.0)
+    if (cur_time - fps_window_start_ >= 1.0)
     {
         framerate_ = frame_count_;
         frame_count_ = 0;
-        prev_time_ = cur_time;
+        fps_window_start_ = cur_time;
     }
 }
 
@@ -55,6 +60,14 @@ string_view SceneDebugService::GetName() const
     return "SceneDebugService";
 }
 
+ServiceAccess SceneDebugService::GetAccess() const
+{
+    return ServiceAccess{
+        .reads = service_access::kInput | service_access::kScene,
+        .writes = service_access::kNone,
+        .main_thread = false};
+}
+
 void SceneDebugService::OnGui()
 {
     if (!show_menu_)
@@ -88,6 +101,12 @@ void SceneDebugService::OnGui()
         ImGui::EndTabItem();
     }
 
+    if (ImGui::BeginTabItem("Events"))
+    {
+        DrawEventTab();
+        ImGui::EndTabItem();
+    }
+
     ImGui::EndTabBar();
     ImGui::End();
 }
@@ -95,6 +114,13 @@ void SceneDebugService::OnGui()
 void SceneDebugService::DrawGeneralTab()
 {
     ImGui::Text("FPS: %d", framerate_);
+
+    int max_fps = static_cast<int>(GetApp().GetMaxFps());
+    if (ImGui::SliderInt("Max FPS (0 = uncapped)", &max_fps, 0, 240))
+    {
+        GetApp().SetMaxFps(static_cast<double>(max_fps));
+    }
+
     ImGui::Text("Active scene: %s", active_scene_->GetName().c_str());
 
     if (ImGui::Button("Reload Scene"))
@@ -103,6 +129,16 @@ void SceneDebugService::DrawGeneralTab()
         GetApp().SetActiveScene(active_scene_->GetName());
     }
 
+    if (snapshot_service_ && snapshot_service_->HasSnapshot())
+    {
+        ImGui::SameLine();
+
+        if (ImGui::Button("Restore Snapshot"))
+        {
+            snapshot_service_->RequestRestore();
+        }
+    }
+
     ImGui::Checkbox("Show ImGui demo", &show_demo_menu_);
     if (show_demo_menu_)
     {
@@ -167,3 +203,144 @@ void SceneDebugService::SetActiveScene(const std::string& name)
 {
     GetApp().SetActiveScene(name);
 }
+
+void SceneDebugService::DrawEventTab()
+{
+    // The active scene's bus is downstream, so it follows along
+    EventBus& app_bus = GetEventBus();
+    bool enabled = app_bus.IsStatsEnabled();
+
+    if (ImGui::Checkbox("Record event stats", &enabled))
+    {
+        app_bus.SetStatsEnabled(enabled);
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Reset"))
+    {
+        app_bus.ResetStats();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Export CSV"))
+    {
+        ExportEventStats();
+    }
+
+    ImGui::Spacing();
+    ImGui::Text("App");
+    DrawEventStatsTable("App Events", app_bus);
+
+    ImGui::Spacing();
+    ImGui::Text("Scene: %s", active_scene_->GetName().c_str());
+    DrawEventStatsTable("Scene Events", active_scene_->GetEventBus());
+}
+
+void SceneDebugService::DrawEventStatsTable(const char* id,
+                                            const EventBus& event_bus)
+{
+    const ImGuiTableFlags flags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+
+    if (!ImGui::BeginTable(id, 5, flags))
+    {
+        return;
+    }
+
+    ImGui::TableSetupColumn("Event / Subscriber");
+    ImGui::TableSetupColumn("Publishes");
+    ImGui::TableSetupColumn("Calls");
+    ImGui::TableSetupColumn("Total (ms)");
+    ImGui::TableSetupColumn("Max (ms)");
+    ImGui::TableHeadersRow();
+
+    for (auto& event : event_bus.GetStats())
+    {
+        double total_ms = 0.0;
+        double max_ms = 0.0;
+
+        for (auto& subscriber : event.subscribers)
+        {
+            total_ms += subscriber.total_ms;
+            max_ms = std::max(max_ms, subscriber.max_ms);
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        const bool open = ImGui::TreeNode(event.name.c_str(), "%s (%zu)",
+                                          event.name.c_str(),
+                                          event.subscriber_count);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u/frame", event.publishes);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu",
+                    static_cast<unsigned long long>(event.total_publishes));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", total_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", max_ms);
+
+        if (!open)
+        {
+            continue;
+        }
+
+        for (auto& subscriber : event.subscribers)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Indent(kComponentGuiIndent);
+            ImGui::Text("%s", subscriber.name.c_str());
+            ImGui::Unindent(kComponentGuiIndent);
+            ImGui::TableNextColumn();
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu",
+                        static_cast<unsigned long long>(subscriber.calls));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", subscriber.total_ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", subscriber.max_ms);
+        }
+
+        ImGui::TreePop();
+    }
+
+    ImGui::EndTable();
+}
+
+void SceneDebugService::ExportEventStats()
+{
+    std::ofstream file(kEventStatsPath);
+
+    if (!file.is_open())
+    {
+        debug::LogError("Failed to save event stats to: {}", kEventStatsPath);
+        return;
+    }
+
+    file << "bus,event,publishes_per_frame,total_publishes,subscribers,"
+            "subscriber,calls,total_ms,max_ms\n";
+
+    const auto write_bus = [&file](string_view bus, const EventBus& event_bus)
+    {
+        for (auto& event : event_bus.GetStats())
+        {
+            for (auto& subscriber : event.subscribers)
+            {
+                // Type names can have commas in them, so they're quoted
+                file << fmt::format(
+                    "{},\"{}\",{},{},{},\"{}\",{},{:.4f},{:.4f}\n", bus,
+                    event.name, event.publishes, event.total_publishes,
+                    event.subscriber_count, subscriber.name, subscriber.calls,
+                    subscriber.total_ms, subscriber.max_ms);
+            }
+        }
+    };
+
+    write_bus("app", GetEventBus());
+    write_bus("scene", active_scene_->GetEventBus());
+
+    debug::LogInfo("Saved event stats to: {}", kEventStatsPath);
+}
@@ -2,6 +2,7 @@
 
 #include "engine/gui/OnGuiEvent.h"
 #include "engine/input/InputService.h"
+#include "engine/scene/SceneSnapshotService.h"
 #include "engine/service/Service.h"
 
 class SceneDebugService final : public Service,
@@ -11,9 +12,10 @@ class SceneDebugService final : public Service,
     // From Service
     void OnInit() override;
     void OnStart(ServiceProvider& service_provider) override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     void SetActiveScene(const std::string& name);
 
@@ -22,14 +24,18 @@ class SceneDebugService final : public Service,
 
   private:
     jss::object_ptr<InputService> input_service_;
+    jss::object_ptr<SceneSnapshotService> snapshot_service_;
     jss::object_ptr<Scene> active_scene_;
     bool show_demo_menu_ = false;
     bool show_menu_ = false;
     int framerate_;
-    double prev_time_;
+    double fps_window_start_;
     int frame_count_;
 
     void DrawGeneralTab();
     void DrawEntityTab();
     void DrawSceneTab();
+    void DrawEventTab();
+    void DrawEventStatsTable(const char* id, const EventBus& event_bus);
+    void ExportEventStats();
 };
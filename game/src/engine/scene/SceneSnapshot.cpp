@@ -0,0 +1,111 @@
+#include "engine/scene/SceneSnapshot.h"
+
+#include <algorithm>
+
+#include "engine/core/debug/Log.h"
+#include "engine/scene/Entity.h"
+
+using std::vector;
+
+static bool CompareHandles(EntityHandle a, EntityHandle b)
+{
+    return a.value < b.value;
+}
+
+SceneSnapshot::SceneSnapshot(Scene& scene)
+    : scene_(&scene),
+      entities_{},
+      components_{}
+{
+    const vector<Entity*>& entities = scene.GetEntities();
+    entities_.reserve(entities.size());
+
+    for (Entity* entity : entities)
+    {
+        entities_.push_back(EntityRecord{.handle = entity->GetHandle(),
+                                         .mask = entity->GetComponentMask()});
+    }
+
+    std::sort(entities_.begin(), entities_.end(),
+              [](const EntityRecord& a, const EntityRecord& b)
+              { return CompareHandles(a.handle, b.handle); });
+}
+
+bool SceneSnapshot::CanRestore() const
+{
+    for (const EntityRecord& record : entities_)
+    {
+        Entity* entity = scene_->GetEntity(record.handle);
+
+        if (!entity)
+        {
+            debug::LogWarn("[SceneSnapshot] Entity {} was destroyed",
+                           record.handle.value);
+            return false;
+        }
+
+        if (entity->GetComponentMask() != record.mask)
+        {
+            debug::LogWarn("[SceneSnapshot] Entity '{}' changed components",
+                           entity->GetName());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SceneSnapshot::Restore()
+{
+    ASSERT_MSG(CanRestore(), "Scene no longer matches the snapshot");
+
+    for (Entity* entity : scene_->GetEntities())
+    {
+        if (!IsCaptured(entity->GetHandle()))
+        {
+            scene_->DestroyEntity(entity->GetHandle());
+        }
+    }
+
+    // Gone before anything is restored, so nothing can refer back to them
+    scene_->FlushDestroyedEntities();
+
+    for (auto& components : components_)
+    {
+        components->Restore();
+    }
+
+    scene_->GetTransformHierarchy().Update();
+}
+
+Scene& SceneSnapshot::GetScene() const
+{
+    return *scene_;
+}
+
+size_t SceneSnapshot::GetEntityCount() const
+{
+    return entities_.size();
+}
+
+size_t SceneSnapshot::GetComponentCount() const
+{
+    size_t count = 0;
+
+    for (const auto& components : components_)
+    {
+        count += components->GetSize();
+    }
+
+    return count;
+}
+
+bool SceneSnapshot::IsCaptured(EntityHandle handle) const
+{
+    auto iter = std::lower_bound(
+        entities_.begin(), entities_.end(), handle,
+        [](const EntityRecord& record, EntityHandle value)
+        { return CompareHandles(record.handle, value); });
+
+    return iter != entities_.end() && iter->handle == handle;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <concepts>
+#include <memory>
+#include <object_ptr.hpp>
+#include <vector>
+
+#include "engine/scene/Component.h"
+#include "engine/scene/ComponentTypeId.h"
+#include "engine/scene/EntityHandle.h"
+#include "engine/scene/Scene.h"
+
+/**
+ * Components a SceneSnapshot can save. SnapshotState is a copy of everything
+ * about the component that changes at runtime, references to other
+ * components and services are left alone
+ */
+template <class ComponentType>
+concept SnapshotComponent =
+    std::derived_from<ComponentType, Component> &&
+    std::copyable<typename ComponentType::SnapshotState> &&
+    requires(const ComponentType& component,
+             ComponentType& mutable_component,
+             const typename ComponentType::SnapshotState& state) {
+        {
+            component.SaveSnapshot()
+        } -> std::same_as<typename ComponentType::SnapshotState>;
+        mutable_component.RestoreSnapshot(state);
+    };
+
+// Saved state of every component of one type
+class IComponentSnapshot
+{
+  public:
+    virtual ~IComponentSnapshot() = default;
+
+    virtual void Restore() = 0;
+    virtual size_t GetSize() const = 0;
+};
+
+template <class ComponentType>
+    requires SnapshotComponent<ComponentType>
+class ComponentSnapshot final : public IComponentSnapshot
+{
+  public:
+    ComponentSnapshot(Scene& scene) : entries_{}
+    {
+        scene.ForEachComponent<ComponentType>(
+            [this](ComponentType& component)
+            {
+                entries_.push_back(Entry{.component = &component,
+                                         .state = component.SaveSnapshot()});
+            });
+    }
+
+    void Restore() override
+    {
+        for (Entry& entry : entries_)
+        {
+            entry.component->RestoreSnapshot(entry.state);
+        }
+    }
+
+    size_t GetSize() const override
+    {
+        return entries_.size();
+    }
+
+  private:
+    struct Entry
+    {
+        jss::object_ptr<ComponentType> component;
+        typename ComponentType::SnapshotState state;
+    };
+
+    std::vector<Entry> entries_;
+};
+
+/**
+ * The runtime state of a scene at one point in time. Restoring it destroys
+ * every entity added since, then puts each captured component back in place.
+ *
+ * Components are restored in place, which only works while the scene still
+ * has the same entities with the same components. Check CanRestore first,
+ * and reload the scene instead if it can't be restored
+ */
+class SceneSnapshot
+{
+  public:
+    SceneSnapshot(Scene& scene);
+
+    // Saves every component of that type, they're restored in capture order
+    template <class ComponentType>
+        requires SnapshotComponent<ComponentType>
+    void Capture()
+    {
+        components_.push_back(
+            std::make_unique<ComponentSnapshot<ComponentType>>(*scene_));
+    }
+
+    bool CanRestore() const;
+    void Restore();
+
+    Scene& GetScene() const;
+    size_t GetEntityCount() const;
+    size_t GetComponentCount() const;
+
+  private:
+    struct EntityRecord
+    {
+        EntityHandle handle;
+        ComponentMask mask;
+    };
+
+    jss::object_ptr<Scene> scene_;
+
+    // Sorted by handle, so entities added since can be found quickly
+    std::vector<EntityRecord> entities_;
+    std::vector<std::unique_ptr<IComponentSnapshot>> components_;
+
+    bool IsCaptured(EntityHandle handle) const;
+};
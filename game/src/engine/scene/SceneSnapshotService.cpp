@@ -0,0 +1,162 @@
+#include "engine/scene/SceneSnapshotService.h"
+
+#include <chrono>
+
+#include "engine/App.h"
+#include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
+#include "engine/physics/RigidBodyComponent.h"
+#include "engine/render/MeshRenderer.h"
+#include "engine/scene/Transform.h"
+#include "engine/service/ServiceProvider.h"
+
+using std::string_view;
+
+using Clock = std::chrono::steady_clock;
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+SceneSnapshotService::SceneSnapshotService()
+    : service_provider_(nullptr),
+      active_scene_(nullptr),
+      capture_functions_{},
+      snapshot_(nullptr),
+      reloading_scene_{},
+      reload_count_(0),
+      capture_requested_(false),
+      restore_requested_(false)
+{
+}
+
+void SceneSnapshotService::RequestCapture()
+{
+    capture_requested_ = true;
+}
+
+void SceneSnapshotService::RequestRestore()
+{
+    restore_requested_ = true;
+}
+
+bool SceneSnapshotService::HasSnapshot() const
+{
+    return snapshot_ != nullptr;
+}
+
+uint32_t SceneSnapshotService::GetReloadCount() const
+{
+    return reload_count_;
+}
+
+void SceneSnapshotService::OnInit()
+{
+    // Transforms go first, rigid bodies may be driven by them
+    RegisterComponent<Transform>();
+    RegisterComponent<RigidBodyComponent>();
+    RegisterComponent<MeshRenderer>();
+}
+
+void SceneSnapshotService::OnStart(ServiceProvider& service_provider)
+{
+    service_provider_ = &service_provider;
+}
+
+void SceneSnapshotService::OnSceneLoaded(Scene& scene)
+{
+    active_scene_ = &scene;
+
+    // The loading scene may be shown first, so wait for the reloaded one
+    if (scene.GetName() == reloading_scene_)
+    {
+        capture_requested_ = true;
+        reloading_scene_.clear();
+    }
+}
+
+void SceneSnapshotService::OnSceneUnloaded(Scene& scene)
+{
+    // Every handle it holds is stale once the scene is unloaded
+    active_scene_ = nullptr;
+    snapshot_.reset();
+    capture_requested_ = false;
+    restore_requested_ = false;
+}
+
+void SceneSnapshotService::OnUpdate(const FrameContext& frame)
+{
+    if (!active_scene_)
+    {
+        return;
+    }
+
+    if (capture_requested_.exchange(false))
+    {
+        Capture();
+    }
+
+    if (restore_requested_.exchange(false))
+    {
+        Restore();
+    }
+}
+
+void SceneSnapshotService::OnCleanup()
+{
+    snapshot_.reset();
+}
+
+string_view SceneSnapshotService::GetName() const
+{
+    return "SceneSnapshotService";
+}
+
+ServiceAccess SceneSnapshotService::GetAccess() const
+{
+    // Restoring puts back the scene, then the physics and game state services
+    // resync to it from OnSceneRestored
+    return ServiceAccess{.reads = service_access::kScene,
+                         .writes = service_access::kScene |
+                                   service_access::kPhysics |
+                                   service_access::kGameState,
+                         .main_thread = true};
+}
+
+void SceneSnapshotService::Capture()
+{
+    PROFILE_SCOPE("SceneSnapshotService::Capture");
+    const Clock::time_point start = Clock::now();
+
+    snapshot_ = std::make_unique<SceneSnapshot>(*active_scene_);
+
+    for (CaptureFunction capture : capture_functions_)
+    {
+        capture(*snapshot_);
+    }
+
+    debug::LogInfo(
+        "Captured scene '{}': {} entities, {} components in {:.2f}ms",
+        active_scene_->GetName(), snapshot_->GetEntityCount(),
+        snapshot_->GetComponentCount(),
+        Milliseconds(Clock::now() - start).count());
+}
+
+void SceneSnapshotService::Restore()
+{
+    if (!snapshot_ || !snapshot_->CanRestore())
+    {
+        debug::LogWarn("Cannot restore scene '{}', reloading it instead",
+                       active_scene_->GetName());
+        reloading_scene_ = active_scene_->GetName();
+        reload_count_++;
+        GetApp().SetActiveScene(active_scene_->GetName());
+        return;
+    }
+
+    PROFILE_SCOPE("SceneSnapshotService::Restore");
+    const Clock::time_point start = Clock::now();
+
+    snapshot_->Restore();
+    service_provider_->DispatchSceneRestored(*active_scene_);
+
+    debug::LogInfo("Restored scene '{}' in {:.2f}ms", active_scene_->GetName(),
+                   Milliseconds(Clock::now() - start).count());
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <object_ptr.hpp>
+#include <string>
+#include <vector>
+
+#include "engine/scene/SceneSnapshot.h"
+#include "engine/service/Service.h"
+
+/**
+ * Keeps a SceneSnapshot of the active scene, so it can be reset to that point
+ * in milliseconds instead of being unloaded and loaded again. Only components
+ * of registered types are captured, every other component keeps its state.
+ *
+ * Capturing and restoring both happen at the start of the next frame, while
+ * the simulation is idle and after whatever loaded the scene has run. If the
+ * scene can't be restored any more, it's reloaded instead and captured again
+ * once loaded, so the next restore is fast again
+ */
+class SceneSnapshotService final : public Service
+{
+  public:
+    SceneSnapshotService();
+
+    /**
+     * Base types like RigidBodyComponent capture every derived type, so don't
+     * register those separately
+     */
+    template <class ComponentType>
+        requires SnapshotComponent<ComponentType>
+    void RegisterComponent()
+    {
+        capture_functions_.push_back(&CaptureComponents<ComponentType>);
+    }
+
+    void RequestCapture();
+    void RequestRestore();
+    bool HasSnapshot() const;
+
+    // Restores that had to reload the scene instead
+    uint32_t GetReloadCount() const;
+
+    // From Service
+    void OnInit() override;
+    void OnStart(ServiceProvider& service_provider) override;
+    void OnSceneLoaded(Scene& scene) override;
+    void OnSceneUnloaded(Scene& scene) override;
+    void OnUpdate(const FrameContext& frame) override;
+    void OnCleanup() override;
+    std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
+
+  private:
+    using CaptureFunction = void (*)(SceneSnapshot& snapshot);
+
+    jss::object_ptr<ServiceProvider> service_provider_;
+    jss::object_ptr<Scene> active_scene_;
+    std::vector<CaptureFunction> capture_functions_;
+    std::unique_ptr<SceneSnapshot> snapshot_;
+
+    // Scene reloaded by a failed restore, captured again once it's loaded
+    std::string reloading_scene_;
+    uint32_t reload_count_;
+
+    // Races can finish on the simulation thread
+    std::atomic<bool> capture_requested_;
+    std::atomic<bool> restore_requested_;
+
+    void Capture();
+    void Restore();
+
+    template <class ComponentType>
+    static void CaptureComponents(SceneSnapshot& snapshot)
+    {
+        snapshot.Capture<ComponentType>();
+    }
+};
@@ -0,0 +1,64 @@
+#include "engine/scene/SceneView.h"
+
+using std::vector;
+
+SceneViewCache::SceneViewCache(const ComponentMask& mask)
+    : mask_(mask),
+      entities_{},
+      positions_{}
+{
+}
+
+void SceneViewCache::Update(Entity& entity)
+{
+    const bool matches = (entity.GetComponentMask() & mask_) == mask_;
+    const bool contains = positions_.contains(&entity);
+
+    if (matches && !contains)
+    {
+        positions_.emplace(&entity, entities_.size());
+        entities_.push_back(&entity);
+    }
+    else if (!matches && contains)
+    {
+        Remove(entity);
+    }
+}
+
+void SceneViewCache::Remove(const Entity& entity)
+{
+    auto iter = positions_.find(&entity);
+
+    if (iter == positions_.end())
+    {
+        return;
+    }
+
+    // Move the last entity into the gap instead of shifting everything down
+    const size_t position = iter->second;
+    positions_.erase(iter);
+
+    if (position != entities_.size() - 1)
+    {
+        entities_[position] = entities_.back();
+        positions_[entities_[position]] = position;
+    }
+
+    entities_.pop_back();
+}
+
+void SceneViewCache::Clear()
+{
+    entities_.clear();
+    positions_.clear();
+}
+
+const ComponentMask& SceneViewCache::GetMask() const
+{
+    return mask_;
+}
+
+const vector<Entity*>& SceneViewCache::GetEntities() const
+{
+    return entities_;
+}
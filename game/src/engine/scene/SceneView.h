@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <object_ptr.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/scene/ComponentTypeId.h"
+#include "engine/scene/Entity.h"
+
+/**
+ * Every entity in a Scene that has all the components in a mask. The Scene
+ * keeps it up to date as components are added and entities destroyed, so
+ * reading it never scans entities that don't match
+ */
+class SceneViewCache
+{
+  public:
+    SceneViewCache(const ComponentMask& mask);
+
+    // Adds or removes the entity depending on whether it matches the mask
+    void Update(Entity& entity);
+    void Remove(const Entity& entity);
+    void Clear();
+
+    const ComponentMask& GetMask() const;
+    const std::vector<Entity*>& GetEntities() const;
+
+  private:
+    ComponentMask mask_;
+    std::vector<Entity*> entities_;
+
+    // Where each entity is in entities_, so removing one is constant time
+    std::unordered_map<const Entity*, size_t> positions_;
+};
+
+/**
+ * Entities that have every one of ComponentTypes, see Scene::View. Cheap to
+ * copy, it only points at the scene's cache
+ */
+template <class... ComponentTypes>
+class SceneView
+{
+  public:
+    SceneView(const SceneViewCache& cache) : cache_(&cache)
+    {
+    }
+
+    /**
+     * Calls function(Entity&, ComponentTypes&...) for every match. Entities
+     * that start matching during iteration may or may not be visited
+     */
+    template <class Function>
+    void ForEach(Function&& function) const
+    {
+        const std::vector<Entity*>& entities = cache_->GetEntities();
+
+        // Indices rather than iterators, the function may add components
+        for (size_t i = 0; i < entities.size(); i++)
+        {
+            Entity& entity = *entities[i];
+            function(entity, entity.GetComponent<ComponentTypes>()...);
+        }
+    }
+
+    std::vector<Entity*>::const_iterator begin() const
+    {
+        return cache_->GetEntities().begin();
+    }
+
+    std::vector<Entity*>::const_iterator end() const
+    {
+        return cache_->GetEntities().end();
+    }
+
+    size_t GetSize() const
+    {
+        return cache_->GetEntities().size();
+    }
+
+  private:
+    jss::object_ptr<const SceneViewCache> cache_;
+};
@@ -0,0 +1,168 @@
+#include "engine/scene/SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "engine/core/debug/Assert.h"
+#include "engine/scene/Transform.h"
+
+using glm::vec3;
+
+// Roughly a kart length or two, so a cell holds a handful of entities
+static constexpr float kCellSize = 25.0f;
+
+// Far outside any track, and small enough that a range of cells can't
+// overflow when ForEachCandidate counts or walks it
+static constexpr float kMaxCellCoord = static_cast<float>(1 << 29);
+
+SpatialIndex::SpatialIndex() : entries_{}, cells_{}
+{
+}
+
+void SpatialIndex::Add(Transform& transform)
+{
+    ASSERT_MSG(transform.spatial_index_slot_ < 0,
+               "Transform is already in the spatial index");
+
+    const vec3 position = transform.GetWorldPosition();
+    const uint32_t index = static_cast<uint32_t>(entries_.size());
+
+    entries_.push_back(Entry{.transform = &transform,
+                             .entity = &transform.GetEntity(),
+                             .position = position,
+                             .version = transform.GetWorldVersion(),
+                             .cell = GetCellKey(position)});
+
+    transform.spatial_index_slot_ = static_cast<int32_t>(index);
+    InsertIntoCell(index);
+}
+
+void SpatialIndex::Remove(Transform& transform)
+{
+    const int32_t slot = transform.spatial_index_slot_;
+
+    if (slot < 0)
+    {
+        return;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(slot);
+    const uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+
+    RemoveFromCell(index);
+
+    // The last entry fills the gap, its cell has to point at the new index
+    if (index != last)
+    {
+        RemoveFromCell(last);
+        entries_[index] = entries_[last];
+        entries_[index].transform->spatial_index_slot_ = slot;
+        InsertIntoCell(index);
+    }
+
+    entries_.pop_back();
+    transform.spatial_index_slot_ = -1;
+}
+
+void SpatialIndex::Update()
+{
+    for (uint32_t i = 0; i < entries_.size(); i++)
+    {
+        Entry& entry = entries_[i];
+        const uint32_t version = entry.transform->GetWorldVersion();
+
+        if (version == entry.version)
+        {
+            continue;
+        }
+
+        entry.version = version;
+        entry.position = entry.transform->GetWorldPosition();
+
+        const uint64_t cell = GetCellKey(entry.position);
+
+        if (cell != entry.cell)
+        {
+            RemoveFromCell(i);
+            entry.cell = cell;
+            InsertIntoCell(i);
+        }
+    }
+}
+
+void SpatialIndex::Clear()
+{
+    for (Entry& entry : entries_)
+    {
+        entry.transform->spatial_index_slot_ = -1;
+    }
+
+    entries_.clear();
+    cells_.clear();
+}
+
+size_t SpatialIndex::GetSize() const
+{
+    return entries_.size();
+}
+
+int32_t SpatialIndex::GetCellCoord(float value)
+{
+    const float cell = std::floor(value / kCellSize);
+
+    // Converting NaN or anything past int32 is undefined, so huge and
+    // infinite radii end up at the edge instead
+    if (std::isnan(cell))
+    {
+        return 0;
+    }
+
+    return static_cast<int32_t>(
+        std::clamp(cell, -kMaxCellCoord, kMaxCellCoord));
+}
+
+uint64_t SpatialIndex::GetCellKey(int32_t x, int32_t z)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(z));
+}
+
+uint64_t SpatialIndex::GetCellKey(const vec3& position) const
+{
+    return GetCellKey(GetCellCoord(position.x), GetCellCoord(position.z));
+}
+
+void SpatialIndex::InsertIntoCell(uint32_t index)
+{
+    const Entry& entry = entries_[index];
+    auto [iter, inserted] = cells_.try_emplace(entry.cell);
+    Cell& cell = iter->second;
+
+    if (inserted)
+    {
+        cell.x = GetCellCoord(entry.position.x);
+        cell.z = GetCellCoord(entry.position.z);
+    }
+
+    cell.entries.push_back(index);
+}
+
+void SpatialIndex::RemoveFromCell(uint32_t index)
+{
+    auto iter = cells_.find(entries_[index].cell);
+    ASSERT_MSG(iter != cells_.end(), "Spatial index entry has no cell");
+
+    std::vector<uint32_t>& cell_entries = iter->second.entries;
+    auto entry_iter =
+        std::find(cell_entries.begin(), cell_entries.end(), index);
+
+    // Order within a cell doesn't matter
+    *entry_iter = cell_entries.back();
+    cell_entries.pop_back();
+
+    // Keeps the map to occupied cells, which large queries walk directly
+    if (cell_entries.empty())
+    {
+        cells_.erase(iter);
+    }
+}
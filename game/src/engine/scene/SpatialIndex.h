@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <object_ptr.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/scene/Component.h"
+#include "engine/scene/Entity.h"
+
+class Transform;
+
+/**
+ * Uniform grid over the world position of every Transform in a scene, for
+ * finding entities near a point without raycasting or scanning the scene.
+ * Cells are columns on the XZ plane since tracks are mostly flat, height is
+ * only checked against each candidate.
+ *
+ * Update compares each transform's world version with the one it last saw,
+ * and only moves the ones that changed into their new cell. Queries see the
+ * positions from the last update
+ */
+class SpatialIndex
+{
+  public:
+    SpatialIndex();
+
+    void Add(Transform& transform);
+    void Remove(Transform& transform);
+    void Update();
+    void Clear();
+
+    // Calls function(Entity&) for every entity within radius of center
+    template <class Function>
+    void ForEachInRadius(const glm::vec3& center, float radius,
+                         Function&& function) const
+    {
+        const float radius_sq = radius * radius;
+
+        ForEachCandidate(center, radius,
+                         [&](const Entry& entry)
+                         {
+                             const glm::vec3 offset = entry.position - center;
+
+                             if (glm::dot(offset, offset) <= radius_sq)
+                             {
+                                 function(*entry.entity);
+                             }
+                         });
+    }
+
+    /**
+     * Calls function(Entity&) for every entity inside the cone at apex,
+     * opening along a normalized direction by half_angle radians
+     */
+    template <class Function>
+    void ForEachInCone(const glm::vec3& apex, const glm::vec3& direction,
+                       float range, float half_angle,
+                       Function&& function) const
+    {
+        const float range_sq = range * range;
+        const float cos_half_angle = std::cos(half_angle);
+
+        ForEachCandidate(
+            apex, range,
+            [&](const Entry& entry)
+            {
+                const glm::vec3 offset = entry.position - apex;
+                const float distance_sq = glm::dot(offset, offset);
+
+                if (distance_sq > range_sq)
+                {
+                    return;
+                }
+
+                // Avoids normalizing, cos is compared against the scaled dot
+                if (glm::dot(offset, direction) >=
+                    cos_half_angle * std::sqrt(distance_sq))
+                {
+                    function(*entry.entity);
+                }
+            });
+    }
+
+    // Appends the ComponentType of every entity in range that has one
+    template <class ComponentType>
+        requires std::derived_from<ComponentType, Component>
+    void QueryRadius(const glm::vec3& center, float radius,
+                     std::vector<ComponentType*>& out) const
+    {
+        ForEachInRadius(center, radius,
+                        [&out](Entity& entity)
+                        { AppendComponent<ComponentType>(entity, out); });
+    }
+
+    template <class ComponentType>
+        requires std::derived_from<ComponentType, Component>
+    void QueryCone(const glm::vec3& apex, const glm::vec3& direction,
+                   float range, float half_angle,
+                   std::vector<ComponentType*>& out) const
+    {
+        ForEachInCone(apex, direction, range, half_angle,
+                      [&out](Entity& entity)
+                      { AppendComponent<ComponentType>(entity, out); });
+    }
+
+    size_t GetSize() const;
+
+  private:
+    struct Entry
+    {
+        jss::object_ptr<Transform> transform;
+        jss::object_ptr<Entity> entity;
+        glm::vec3 position;
+        uint32_t version;
+        uint64_t cell;
+    };
+
+    struct Cell
+    {
+        int32_t x;
+        int32_t z;
+
+        // Indices into entries_
+        std::vector<uint32_t> entries;
+    };
+
+    std::vector<Entry> entries_;
+    std::unordered_map<uint64_t, Cell> cells_;
+
+    static int32_t GetCellCoord(float value);
+    static uint64_t GetCellKey(int32_t x, int32_t z);
+    uint64_t GetCellKey(const glm::vec3& position) const;
+
+    void InsertIntoCell(uint32_t index);
+    void RemoveFromCell(uint32_t index);
+
+    template <class Function>
+    void ForEachCandidate(const glm::vec3& center, float radius,
+                          Function&& function) const
+    {
+        const int32_t min_x = GetCellCoord(center.x - radius);
+        const int32_t max_x = GetCellCoord(center.x + radius);
+        const int32_t min_z = GetCellCoord(center.z - radius);
+        const int32_t max_z = GetCellCoord(center.z + radius);
+
+        const size_t cells_in_range = static_cast<size_t>(max_x - min_x + 1) *
+                                      static_cast<size_t>(max_z - min_z + 1);
+
+        // Huge queries visit the occupied cells instead of every one in range
+        if (cells_in_range > cells_.size())
+        {
+            for (const auto& [key, cell] : cells_)
+            {
+                if (cell.x >= min_x && cell.x <= max_x && cell.z >= min_z &&
+                    cell.z <= max_z)
+                {
+                    for (uint32_t index : cell.entries)
+                    {
+                        function(entries_[index]);
+                    }
+                }
+            }
+
+            return;
+        }
+
+        for (int32_t x = min_x; x <= max_x; x++)
+        {
+            for (int32_t z = min_z; z <= max_z; z++)
+            {
+                auto iter = cells_.find(GetCellKey(x, z));
+
+                if (iter == cells_.end())
+                {
+                    continue;
+                }
+
+                for (uint32_t index : iter->second.entries)
+                {
+                    function(entries_[index]);
+                }
+            }
+        }
+    }
+
+    template <class ComponentType>
+    static void AppendComponent(Entity& entity,
+                                std::vector<ComponentType*>& out)
+    {
+        if (ComponentType* component = entity.TryGetComponent<ComponentType>())
+        {
+            out.push_back(component);
+        }
+    }
+};
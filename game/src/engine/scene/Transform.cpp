@@ -5,7 +5,10 @@
 #include <iostream>
 
 #include "engine/core/gui/PropertyWidgets.h"
+#include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
 
+using glm::mat3;
 using glm::mat4;
 using glm::quat;
 using glm::vec3;
@@ -26,11 +29,23 @@ Transform::Transform()
       forward_dir_(kDefaultForwardDir),
       up_dir_(kDefaultUpDir),
       right_dir_(kDefaultRightDir),
+      prev_position_(position_),
+      prev_orientation_(orientation_),
       translation_matrix_(1.0f),
       rotation_matrix_(1.0f),
       scale_matrix_(1.0f),
+      local_matrix_(1.0f),
       model_matrix_(1.0f),
-      normal_matrix_(1.0f)
+      normal_matrix_(1.0f),
+      world_orientation_(orientation_),
+      world_version_(0),
+      hierarchy_(nullptr),
+      parent_(nullptr),
+      child_count_(0),
+      hierarchy_index_(-1),
+      world_changed_(false),
+      spatial_index_(nullptr),
+      spatial_index_slot_(-1)
 {
 }
 
@@ -43,12 +58,14 @@ void Transform::SetScale(const vec3& scale)
 void Transform::Translate(const vec3& delta)
 {
     position_ += delta;
+    ClearPreviousPose();
     UpdateMatrices();
 }
 
 void Transform::SetPosition(const vec3& position)
 {
     position_ = position;
+    ClearPreviousPose();
     UpdateMatrices();
 }
 
@@ -56,12 +73,14 @@ void Transform::LerpPosition(const vec3& target, float t)
 {
     t = glm::clamp(t, 0.0f, 1.0f);
     position_ = glm::mix(position_, target, t);
+    ClearPreviousPose();
     UpdateMatrices();
 }
 
 void Transform::SetOrientation(const quat& orientation)
 {
     orientation_ = orientation;
+    ClearPreviousPose();
     UpdateMatrices();
 }
 
@@ -69,12 +88,14 @@ void Transform::SlerpOrientation(const quat& target, float t)
 {
     t = glm::clamp(t, 0.0f, 1.0f);
     orientation_ = glm::slerp(orientation_, target, t);
+    ClearPreviousPose();
     UpdateMatrices();
 }
 
 void Transform::Rotate(const quat& delta)
 {
     orientation_ = glm::normalize(delta) * orientation_;
+    ClearPreviousPose();
     UpdateMatrices();
 }
 
@@ -95,6 +116,26 @@ void Transform::RotateEulerDegrees(const vec3& delta_euler_degrees)
     Rotate(delta);
 }
 
+void Transform::SetTickPose(const vec3& position, const quat& orientation)
+{
+    prev_position_ = position_;
+    prev_orientation_ = orientation_;
+    position_ = position;
+    orientation_ = orientation;
+    UpdateMatrices();
+}
+
+void Transform::SetParent(Transform* parent)
+{
+    ASSERT_MSG(hierarchy_, "Transform must be initialized to set a parent");
+    hierarchy_->SetParent(*this, parent);
+}
+
+Transform* Transform::GetParent() const
+{
+    return parent_.get();
+}
+
 const vec3& Transform::GetPosition() const
 {
     return position_;
@@ -105,6 +146,16 @@ const quat& Transform::GetOrientation() const
     return orientation_;
 }
 
+vec3 Transform::GetWorldPosition() const
+{
+    return vec3(model_matrix_[3]);
+}
+
+const quat& Transform::GetWorldOrientation() const
+{
+    return world_orientation_;
+}
+
 const vec3& Transform::GetForwardDirection() const
 {
     return forward_dir_;
@@ -130,14 +181,100 @@ const mat4& Transform::GetNormalMatrix() const
     return normal_matrix_;
 }
 
+vec3 Transform::TransformPoint(const vec3& point) const
+{
+    return vec3(model_matrix_ * vec4(point, 1.0f));
+}
+
+uint32_t Transform::GetWorldVersion() const
+{
+    return world_version_;
+}
+
+vec3 Transform::GetInterpolatedPosition(float alpha) const
+{
+    if (parent_)
+    {
+        return vec3(GetInterpolatedModelMatrix(alpha)[3]);
+    }
+
+    return glm::mix(prev_position_, position_, glm::clamp(alpha, 0.0f, 1.0f));
+}
+
+mat4 Transform::GetInterpolatedModelMatrix(float alpha) const
+{
+    mat4 local_matrix = local_matrix_;
+
+    if (HasPreviousPose())
+    {
+        alpha = glm::clamp(alpha, 0.0f, 1.0f);
+        const vec3 position = glm::mix(prev_position_, position_, alpha);
+        const quat orientation =
+            glm::slerp(prev_orientation_, orientation_, alpha);
+
+        local_matrix = glm::translate(mat4(1.0f), position) *
+                       glm::toMat4(orientation) * scale_matrix_;
+    }
+
+    // Children are drawn wherever their parent is drawn
+    if (parent_)
+    {
+        return parent_->GetInterpolatedModelMatrix(alpha) * local_matrix;
+    }
+
+    return local_matrix;
+}
+
+mat4 Transform::GetInterpolatedNormalMatrix(float alpha) const
+{
+    if (!parent_ && !HasPreviousPose())
+    {
+        return normal_matrix_;
+    }
+
+    return glm::transpose(glm::inverse(GetInterpolatedModelMatrix(alpha)));
+}
+
+Transform::SnapshotState Transform::SaveSnapshot() const
+{
+    return SnapshotState{
+        .position = position_, .orientation = orientation_, .scale = scale_};
+}
+
+void Transform::RestoreSnapshot(const SnapshotState& state)
+{
+    position_ = state.position;
+    orientation_ = state.orientation;
+    scale_ = state.scale;
+    ClearPreviousPose();
+    UpdateMatrices();
+}
+
 void Transform::OnInit(const ServiceProvider& service_provider)
 {
+    Scene& scene = GetEntity().GetScene();
+    hierarchy_ = &scene.GetTransformHierarchy();
+    spatial_index_ = &scene.GetSpatialIndex();
+    spatial_index_->Add(*this);
+}
+
+void Transform::OnDestroy()
+{
+    Component::OnDestroy();
+    hierarchy_->Remove(*this);
+    spatial_index_->Remove(*this);
 }
 
 void Transform::OnDebugGui()
 {
     bool dirty = false;
 
+    if (parent_)
+    {
+        ImGui::Text("Parent: %s", parent_->GetEntity().GetName().c_str());
+        ImGui::Spacing();
+    }
+
     dirty |= gui::EditProperty("Position", position_);
     ImGui::Spacing();
 
@@ -150,6 +287,7 @@ void Transform::OnDebugGui()
 
     if (dirty)
     {
+        ClearPreviousPose();
         UpdateMatrices();
     }
 }
@@ -161,15 +299,61 @@ std::string_view Transform::GetName() const
 
 void Transform::UpdateMatrices()
 {
-    // std::cout<<"HAPPPPPPPPPPPPPPPPPPPPPPPPPENINGGGGGGGGGGGGGGGGG";
     translation_matrix_ = glm::translate(mat4(1.0f), position_);
     rotation_matrix_ = glm::toMat4(orientation_);
     scale_matrix_ = glm::scale(mat4(1.0f), scale_);
+    local_matrix_ = translation_matrix_ * rotation_matrix_ * scale_matrix_;
+
+    // Children below this one catch up on the next hierarchy update
+    UpdateWorldMatrix();
+}
+
+void Transform::UpdateWorldMatrix()
+{
+    if (parent_)
+    {
+        model_matrix_ = parent_->model_matrix_ * local_matrix_;
+        world_orientation_ = parent_->world_orientation_ * orientation_;
+    }
+    else
+    {
+        model_matrix_ = local_matrix_;
+        world_orientation_ = orientation_;
+    }
 
-    model_matrix_ = translation_matrix_ * rotation_matrix_ * scale_matrix_;
     normal_matrix_ = glm::transpose(glm::inverse(model_matrix_));
 
-    forward_dir_ = glm::normalize(rotation_matrix_ * kDefaultForwardDir);
-    up_dir_ = glm::normalize(rotation_matrix_ * kDefaultUpDir);
-    right_dir_ = glm::normalize(rotation_matrix_ * kDefaultRightDir);
+    const mat4 world_rotation = glm::toMat4(world_orientation_);
+    forward_dir_ = glm::normalize(world_rotation * kDefaultForwardDir);
+    up_dir_ = glm::normalize(world_rotation * kDefaultUpDir);
+    right_dir_ = glm::normalize(world_rotation * kDefaultRightDir);
+
+    world_version_++;
+    world_changed_ = true;
+}
+
+void Transform::SetLocalMatrix(const mat4& matrix)
+{
+    position_ = vec3(matrix[3]);
+    scale_ = vec3(glm::length(vec3(matrix[0])), glm::length(vec3(matrix[1])),
+                  glm::length(vec3(matrix[2])));
+
+    const mat3 rotation(vec3(matrix[0]) / scale_.x,
+                        vec3(matrix[1]) / scale_.y,
+                        vec3(matrix[2]) / scale_.z);
+    orientation_ = glm::normalize(glm::quat_cast(rotation));
+
+    ClearPreviousPose();
+    UpdateMatrices();
+}
+
+void Transform::ClearPreviousPose()
+{
+    prev_position_ = position_;
+    prev_orientation_ = orientation_;
+}
+
+bool Transform::HasPreviousPose() const
+{
+    return prev_position_ != position_ || prev_orientation_ != orientation_;
 }
\ No newline at end of file
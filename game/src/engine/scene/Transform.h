@@ -3,12 +3,27 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
+#include <object_ptr.hpp>
 
 #include "engine/scene/Component.h"
 
+class SpatialIndex;
+class TransformHierarchy;
+
+/**
+ * Position, orientation and scale of an entity, relative to its parent if it
+ * has one. Model matrices and directions are always in world space
+ */
 class Transform final : public Component
 {
   public:
+    struct SnapshotState
+    {
+        glm::vec3 position;
+        glm::quat orientation;
+        glm::vec3 scale;
+    };
+
     Transform();
 
     void SetPosition(const glm::vec3& position);
@@ -22,8 +37,20 @@ class Transform final : public Component
     void Rotate(const glm::quat& delta);
     void RotateEulerDegrees(const glm::vec3& delta_euler_degrees);
 
+    // Moves to the pose of a new physics tick, keeping the last one around to
+    // interpolate from. Every other setter snaps both poses
+    void SetTickPose(const glm::vec3& position, const glm::quat& orientation);
+
+    // Follows the parent from then on, the current pose becomes relative to it
+    void SetParent(Transform* parent);
+    Transform* GetParent() const;
+
+    // Local, which is the same as world space for transforms without a parent
     const glm::vec3& GetPosition() const;
     const glm::quat& GetOrientation() const;
+
+    glm::vec3 GetWorldPosition() const;
+    const glm::quat& GetWorldOrientation() const;
     const glm::vec3& GetForwardDirection() const;
     const glm::vec3& GetUpDirection() const;
     const glm::vec3& GetRightDirection() const;
@@ -35,24 +62,63 @@ class Transform final : public Component
     */
     const glm::mat4& GetNormalMatrix() const;
 
+    // Maps a point from this transform's space to world space
+    glm::vec3 TransformPoint(const glm::vec3& point) const;
+
+    // Bumped every time the world matrix changes
+    uint32_t GetWorldVersion() const;
+
+    // Blends between the previous and current tick pose, alpha = 1 is current
+    glm::vec3 GetInterpolatedPosition(float alpha) const;
+    glm::mat4 GetInterpolatedModelMatrix(float alpha) const;
+    glm::mat4 GetInterpolatedNormalMatrix(float alpha) const;
+
+    // Parent links aren't part of it, only the pose
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     // From Component
     void OnInit(const ServiceProvider& service_provider) override;
+    void OnDestroy() override;
     void OnDebugGui() override;
     std::string_view GetName() const override;
 
   private:
+    friend class SpatialIndex;
+    friend class TransformHierarchy;
+
     glm::vec3 position_;
     glm::quat orientation_;
     glm::vec3 scale_;
     glm::vec3 forward_dir_;
     glm::vec3 up_dir_;
     glm::vec3 right_dir_;
+    glm::vec3 prev_position_;
+    glm::quat prev_orientation_;
 
     glm::mat4 translation_matrix_;
     glm::mat4 rotation_matrix_;
     glm::mat4 scale_matrix_;
+    glm::mat4 local_matrix_;
     glm::mat4 model_matrix_;
     glm::mat4 normal_matrix_;
+    glm::quat world_orientation_;
+    uint32_t world_version_;
+
+    // Kept up to date by the scene's TransformHierarchy
+    jss::object_ptr<TransformHierarchy> hierarchy_;
+    jss::object_ptr<Transform> parent_;
+    uint32_t child_count_;
+    int32_t hierarchy_index_;
+    bool world_changed_;
+
+    // Where this transform is in the scene's SpatialIndex
+    jss::object_ptr<SpatialIndex> spatial_index_;
+    int32_t spatial_index_slot_;
 
     void UpdateMatrices();
+    void UpdateWorldMatrix();
+    void SetLocalMatrix(const glm::mat4& matrix);
+    void ClearPreviousPose();
+    bool HasPreviousPose() const;
 };
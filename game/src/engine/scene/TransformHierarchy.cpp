@@ -0,0 +1,195 @@
+#include "engine/scene/TransformHierarchy.h"
+
+#include <algorithm>
+
+#include "engine/core/debug/Assert.h"
+#include "engine/scene/Transform.h"
+
+using glm::mat4;
+using std::vector;
+
+TransformHierarchy::TransformHierarchy()
+    : nodes_{},
+      changed_{},
+      order_dirty_(false)
+{
+}
+
+void TransformHierarchy::SetParent(Transform& child, Transform* parent)
+{
+    for (Transform* ancestor = parent; ancestor;
+         ancestor = ancestor->parent_.get())
+    {
+        ASSERT_MSG(ancestor != &child,
+                   "Cannot parent a Transform to itself or its children");
+    }
+
+    Transform* old_parent = child.parent_.get();
+
+    if (old_parent == parent)
+    {
+        return;
+    }
+
+    if (old_parent)
+    {
+        old_parent->child_count_--;
+    }
+
+    child.parent_ = parent;
+
+    if (parent)
+    {
+        parent->child_count_++;
+        AddNode(*parent);
+        AddNode(child);
+    }
+
+    if (old_parent)
+    {
+        RemoveNodeIfUnlinked(*old_parent);
+    }
+
+    RemoveNodeIfUnlinked(child);
+
+    // The local pose is now relative to the new parent
+    child.UpdateWorldMatrix();
+    order_dirty_ = true;
+}
+
+void TransformHierarchy::Remove(Transform& transform)
+{
+    if (transform.hierarchy_index_ < 0)
+    {
+        return;
+    }
+
+    // Removing a transform that has children is rare, so just search for them
+    vector<Transform*> children;
+
+    for (const Node& node : nodes_)
+    {
+        if (node.transform->parent_.get() == &transform)
+        {
+            children.push_back(node.transform.get());
+        }
+    }
+
+    for (Transform* child : children)
+    {
+        const mat4 world = child->GetModelMatrix();
+        SetParent(*child, nullptr);
+        child->SetLocalMatrix(world);
+    }
+
+    SetParent(transform, nullptr);
+}
+
+void TransformHierarchy::Update()
+{
+    if (order_dirty_)
+    {
+        SortNodes();
+    }
+
+    // Parents always come first, so a change flows down to every descendant
+    for (size_t i = 0; i < nodes_.size(); i++)
+    {
+        Node& node = nodes_[i];
+        Transform& transform = *node.transform;
+
+        const bool parent_changed = node.parent >= 0 && changed_[node.parent];
+
+        if (parent_changed)
+        {
+            transform.UpdateWorldMatrix();
+        }
+
+        changed_[i] = parent_changed || transform.world_changed_;
+        transform.world_changed_ = false;
+    }
+}
+
+void TransformHierarchy::Clear()
+{
+    nodes_.clear();
+    changed_.clear();
+    order_dirty_ = false;
+}
+
+size_t TransformHierarchy::GetSize() const
+{
+    return nodes_.size();
+}
+
+void TransformHierarchy::AddNode(Transform& transform)
+{
+    if (transform.hierarchy_index_ >= 0)
+    {
+        return;
+    }
+
+    transform.hierarchy_index_ = static_cast<int32_t>(nodes_.size());
+    nodes_.push_back(Node{.transform = &transform, .parent = -1});
+    order_dirty_ = true;
+}
+
+void TransformHierarchy::RemoveNodeIfUnlinked(Transform& transform)
+{
+    const int32_t index = transform.hierarchy_index_;
+
+    if (index < 0 || transform.parent_ || transform.child_count_ > 0)
+    {
+        return;
+    }
+
+    // Order is restored by the next sort, so the last node can fill the gap
+    if (static_cast<size_t>(index) != nodes_.size() - 1)
+    {
+        nodes_[index] = nodes_.back();
+        nodes_[index].transform->hierarchy_index_ = index;
+    }
+
+    nodes_.pop_back();
+    transform.hierarchy_index_ = -1;
+    order_dirty_ = true;
+}
+
+void TransformHierarchy::SortNodes()
+{
+    vector<uint32_t> depths(nodes_.size());
+
+    for (const Node& node : nodes_)
+    {
+        uint32_t depth = 0;
+
+        for (Transform* ancestor = node.transform->parent_.get(); ancestor;
+             ancestor = ancestor->parent_.get())
+        {
+            depth++;
+        }
+
+        depths[node.transform->hierarchy_index_] = depth;
+    }
+
+    std::stable_sort(nodes_.begin(), nodes_.end(),
+                     [&depths](const Node& a, const Node& b)
+                     {
+                         return depths[a.transform->hierarchy_index_] <
+                                depths[b.transform->hierarchy_index_];
+                     });
+
+    for (size_t i = 0; i < nodes_.size(); i++)
+    {
+        nodes_[i].transform->hierarchy_index_ = static_cast<int32_t>(i);
+    }
+
+    for (Node& node : nodes_)
+    {
+        Transform* parent = node.transform->parent_.get();
+        node.parent = parent ? parent->hierarchy_index_ : -1;
+    }
+
+    changed_.assign(nodes_.size(), 0);
+    order_dirty_ = false;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <object_ptr.hpp>
+#include <vector>
+
+class Transform;
+
+/**
+ * Parent/child links between the transforms of a scene. Only transforms that
+ * have a parent or children are kept here, in one flat array sorted by depth
+ * so every parent comes before its children. Update walks that array once,
+ * and only recomputes the world matrices of subtrees whose local transform
+ * changed since the last update.
+ *
+ * Transforms without a parent keep computing their own matrices as soon as
+ * they're set, exactly like before
+ */
+class TransformHierarchy
+{
+  public:
+    TransformHierarchy();
+
+    // Passing nullptr detaches the child, its local pose is kept as is
+    void SetParent(Transform& child, Transform* parent);
+
+    // Detaches the transform and its children, children keep their world pose
+    void Remove(Transform& transform);
+
+    void Update();
+    void Clear();
+
+    size_t GetSize() const;
+
+  private:
+    struct Node
+    {
+        jss::object_ptr<Transform> transform;
+
+        // Index into nodes_, -1 for roots
+        int32_t parent;
+    };
+
+    std::vector<Node> nodes_;
+
+    // Whether each node's world matrix changed during this update
+    std::vector<uint8_t> changed_;
+
+    // Set when links change, nodes are only sorted again on the next update
+    bool order_dirty_;
+
+    void AddNode(Transform& transform);
+    void RemoveNodeIfUnlinked(Transform& transform);
+    void SortNodes();
+};
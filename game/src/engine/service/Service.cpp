@@ -13,6 +13,11 @@ void Service::Init(ServiceInitializer& initializer)
     OnInit();
 }
 
+void Service::OnScenePrepare(const std::string& scene_name)
+{
+    // To be overridden
+}
+
 void Service::OnSceneLoaded(Scene& scene)
 {
     // To be overridden
@@ -23,6 +28,11 @@ void Service::OnSceneUnloaded(Scene& scene)
     // To be overridden
 }
 
+void Service::OnSceneRestored(Scene& scene)
+{
+    // To be overridden
+}
+
 void Service::OnWindowSizeChanged(int width, int height)
 {
     // To be overridden
@@ -43,6 +53,22 @@ void Service::OnCleanup()
     // To be overridden
 }
 
+void Service::OnPublishSnapshot(const FrameContext& frame)
+{
+    // To be overridden
+}
+
+void Service::OnRender()
+{
+    // To be overridden
+}
+
+ServiceAccess Service::GetAccess() const
+{
+    // To be overridden
+    return ServiceAccess{};
+}
+
 Window& Service::GetWindow()
 {
     ASSERT_MSG(window_, "Service must have valid Window reference");
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <object_ptr.hpp>
+#include <string>
 #include <string_view>
 
 #include "engine/core/debug/Assert.h"
 #include "engine/core/event/EventBus.h"
+#include "engine/core/time/FrameContext.h"
 
 class ServiceProvider;
 class Window;
@@ -18,21 +21,80 @@ struct ServiceInitializer
     App& app;
 };
 
+// Shared state a service can touch from its OnUpdate
+namespace service_access
+{
+static constexpr uint32_t kNone = 0;
+static constexpr uint32_t kInput = 1 << 0;
+static constexpr uint32_t kScene = 1 << 1;  // Entities, components and events
+static constexpr uint32_t kPhysics = 1 << 2;
+static constexpr uint32_t kAudio = 1 << 3;
+static constexpr uint32_t kRender = 1 << 4;  // Render data, not the GL context
+static constexpr uint32_t kGameState = 1 << 5;
+static constexpr uint32_t kPickups = 1 << 6;  // Pickup transforms
+static constexpr uint32_t kAll = ~0u;
+}  // namespace service_access
+
+enum class UpdatePhase : uint8_t
+{
+    // Runs on the main thread while the simulation is idle (input, GUI)
+    kFrame,
+
+    // Runs on the simulation thread, possibly while the last tick renders
+    kSimulation,
+};
+
+/**
+ * What a service reads and writes during OnUpdate. Two services only update
+ * at the same time if neither writes something the other one uses.
+ * main_thread pins a service to the thread driving its phase. Anything
+ * touching GL, ImGui or GLFW input must be in the frame phase
+ */
+struct ServiceAccess
+{
+    uint32_t reads = service_access::kAll;
+    uint32_t writes = service_access::kAll;
+    bool main_thread = true;
+    UpdatePhase phase = UpdatePhase::kFrame;
+};
+
 class Service
 {
   public:
     void Init(ServiceInitializer& initializer);
 
     virtual void OnInit();
+
+    /**
+     * Called on a worker thread before the scene is loaded, to get slow work
+     * like parsing files or cooking meshes out of the way. The active scene
+     * keeps running meanwhile, so this must not touch it
+     */
+    virtual void OnScenePrepare(const std::string& scene_name);
+
     virtual void OnSceneLoaded(Scene& scene);
     virtual void OnSceneUnloaded(Scene& scene);
+
+    // Called after the scene was put back to a SceneSnapshot, instead of
+    // being unloaded and loaded again
+    virtual void OnSceneRestored(Scene& scene);
+
     virtual void OnStart(ServiceProvider& service_provider);
     virtual void OnWindowSizeChanged(int width, int height);
-    virtual void OnUpdate() = 0;
+    virtual void OnUpdate(const FrameContext& frame) = 0;
     virtual void OnCleanup();
 
+    // Called on the simulation thread after every tick, to copy out render state
+    virtual void OnPublishSnapshot(const FrameContext& frame);
+
+    // Called on the main thread, may only read state published above
+    virtual void OnRender();
+
     virtual std::string_view GetName() const = 0;
 
+    // Defaults to exclusive access on the main thread
+    virtual ServiceAccess GetAccess() const;
+
   protected:
     Window& GetWindow();
     EventBus& GetEventBus();
@@ -2,6 +2,7 @@
 
 #include "engine/App.h"
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 
 void ServiceProvider::DispatchInit(App& app)
 {
@@ -9,6 +10,7 @@ void ServiceProvider::DispatchInit(App& app)
 
     ServiceInitializer initializer{
         .window = app.GetWindow(), .service_provider = *this, .app = app};
+    job_system_ = &app.GetJobSystem();
 
     for (auto& pair : services_)
     {
@@ -16,6 +18,23 @@ void ServiceProvider::DispatchInit(App& app)
     }
 }
 
+void ServiceProvider::DispatchScenePrepare(const std::string& scene_name,
+                                           JobCounter& counter)
+{
+    for (auto& pair : services_)
+    {
+        Service* service = pair.service.get();
+
+        job_system_->SubmitBackground(
+            [service, scene_name]()
+            {
+                PROFILE_SCOPE("Service::OnScenePrepare");
+                service->OnScenePrepare(scene_name);
+            },
+            &counter);
+    }
+}
+
 void ServiceProvider::DispatchSceneLoaded(Scene& scene)
 {
     for (auto& pair : services_)
@@ -32,21 +51,64 @@ void ServiceProvider::DispatchSceneUnloaded(Scene& scene)
     }
 }
 
+void ServiceProvider::DispatchSceneRestored(Scene& scene)
+{
+    for (auto& pair : services_)
+    {
+        pair.service->OnSceneRestored(scene);
+    }
+}
+
 void ServiceProvider::DispatchStart()
 {
     debug::LogDebug("[ServiceProvider] Starting services");
 
+    std::vector<Service*> frame_services;
+    std::vector<Service*> simulation_services;
+
     for (auto& pair : services_)
     {
         pair.service->OnStart(*this);
+
+        // Services may depend on state set up in OnStart to declare access
+        if (pair.service->GetAccess().phase == UpdatePhase::kSimulation)
+        {
+            simulation_services.push_back(pair.service.get());
+        }
+        else
+        {
+            frame_services.push_back(pair.service.get());
+        }
     }
+
+    frame_scheduler_.Build(frame_services, *job_system_);
+    simulation_scheduler_.Build(simulation_services, *job_system_);
 }
 
-void ServiceProvider::DispatchUpdate()
+void ServiceProvider::DispatchFrameUpdate(const FrameContext& frame)
 {
+    PROFILE_SCOPE("ServiceProvider::FrameUpdate");
+    frame_scheduler_.Update(frame);
+}
+
+void ServiceProvider::DispatchSimulationUpdate(const FrameContext& frame)
+{
+    PROFILE_SCOPE("ServiceProvider::SimulationUpdate");
+    simulation_scheduler_.Update(frame);
+
+    for (auto& pair : services_)
+    {
+        pair.service->OnPublishSnapshot(frame);
+    }
+}
+
+void ServiceProvider::DispatchRender()
+{
+    PROFILE_SCOPE("ServiceProvider::Render");
+
     for (auto& pair : services_)
     {
-        pair.service->OnUpdate();
+        pair.service->OnRender();
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include <concepts>
 #include <memory>
+#include <string>
 #include <typeindex>
 #include <unordered_map>
 #include <utility>
@@ -11,6 +12,7 @@
 #include "engine/core/event/EventBus.h"
 #include "engine/core/gfx/Window.h"
 #include "engine/service/Service.h"
+#include "engine/service/ServiceScheduler.h"
 
 class App;
 
@@ -58,14 +60,45 @@ class ServiceProvider
         throw new std::exception("Service does not exist");
     }
 
+    /**
+     * Same as GetService, but returns nullptr for services that are not
+     * registered (e.g. rendering services when running headless)
+     */
+    template <class ServiceType>
+        requires std::derived_from<ServiceType, Service>
+    ServiceType* TryGetService() const
+    {
+        std::type_index key = std::type_index(typeid(ServiceType));
+
+        for (auto& entry : services_)
+        {
+            if (entry.type == key)
+            {
+                return static_cast<ServiceType*>(entry.service.get());
+            }
+        }
+
+        return nullptr;
+    }
+
     void DispatchInit(App& app);
     void DispatchStart();
+
+    // Submits every service's OnScenePrepare as a job tracked by counter
+    void DispatchScenePrepare(const std::string& scene_name,
+                              JobCounter& counter);
     void DispatchSceneLoaded(Scene& scene);
     void DispatchSceneUnloaded(Scene& scene);
-    void DispatchUpdate();
+    void DispatchSceneRestored(Scene& scene);
+    void DispatchFrameUpdate(const FrameContext& frame);
+    void DispatchSimulationUpdate(const FrameContext& frame);
+    void DispatchRender();
     void DispatchWindowSizeChanged(int width, int height);
     void DispatchCleanup();
 
   private:
     std::vector<ServiceEntry> services_;
+    jss::object_ptr<JobSystem> job_system_;
+    ServiceScheduler frame_scheduler_;
+    ServiceScheduler simulation_scheduler_;
 };
@@ -0,0 +1,163 @@
+#include "engine/service/ServiceScheduler.h"
+
+#include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
+
+using std::vector;
+
+static bool Conflicts(const ServiceAccess& a, const ServiceAccess& b)
+{
+    return (a.writes & (b.reads | b.writes)) != 0 || (b.writes & a.reads) != 0;
+}
+
+ServiceScheduler::ServiceScheduler()
+    : job_system_(nullptr),
+      frame_(nullptr),
+      nodes_{},
+      main_queue_{},
+      completed_(0),
+      mutex_{},
+      main_cv_{}
+{
+}
+
+void ServiceScheduler::Build(const vector<Service*>& services,
+                             JobSystem& job_system)
+{
+    job_system_ = &job_system;
+    nodes_.clear();
+
+    for (size_t i = 0; i < services.size(); i++)
+    {
+        Node node{.service = services[i],
+                  .access = services[i]->GetAccess(),
+                  .dependents = {},
+                  .dependency_count = 0,
+                  .remaining = 0};
+
+        // Earlier services always win a conflict, which keeps the graph acyclic
+        for (size_t j = 0; j < i; j++)
+        {
+            if (Conflicts(nodes_[j].access, node.access))
+            {
+                nodes_[j].dependents.push_back(i);
+                node.dependency_count++;
+            }
+        }
+
+        nodes_.push_back(std::move(node));
+    }
+
+    debug::LogDebug("[ServiceScheduler] Scheduling {} services on {} workers",
+                    nodes_.size(), job_system.GetWorkerCount());
+}
+
+void ServiceScheduler::Update(const FrameContext& frame)
+{
+    ASSERT_MSG(job_system_, "Scheduler must be built before updating");
+    frame_ = &frame;
+
+    vector<size_t> ready;
+
+    {
+        std::lock_guard lock(mutex_);
+        completed_ = 0;
+
+        for (size_t i = 0; i < nodes_.size(); i++)
+        {
+            nodes_[i].remaining = nodes_[i].dependency_count;
+
+            if (nodes_[i].remaining == 0)
+            {
+                ready.push_back(i);
+            }
+        }
+    }
+
+    SubmitReady(ready);
+
+    // The main thread runs its own services, and helps out with jobs otherwise
+    std::unique_lock lock(mutex_);
+
+    while (completed_ < nodes_.size())
+    {
+        if (!main_queue_.empty())
+        {
+            const size_t index = main_queue_.front();
+            main_queue_.pop_front();
+
+            lock.unlock();
+            RunNode(index);
+            lock.lock();
+            continue;
+        }
+
+        lock.unlock();
+        const bool ran_job = job_system_->RunPendingJob();
+        lock.lock();
+
+        if (!ran_job)
+        {
+            main_cv_.wait(lock,
+                          [this]()
+                          {
+                              return !main_queue_.empty() ||
+                                     completed_ == nodes_.size();
+                          });
+        }
+    }
+}
+
+void ServiceScheduler::RunNode(size_t index)
+{
+    Node& node = nodes_[index];
+
+    {
+        PROFILE_SCOPE(node.service->GetName());
+        node.service->OnUpdate(*frame_);
+    }
+
+    vector<size_t> ready;
+
+    {
+        std::lock_guard lock(mutex_);
+        completed_++;
+
+        for (size_t dependent : node.dependents)
+        {
+            nodes_[dependent].remaining--;
+
+            if (nodes_[dependent].remaining == 0)
+            {
+                ready.push_back(dependent);
+            }
+        }
+
+        // Notify while locked, the main thread may return from Update as soon
+        // as the last service completes
+        main_cv_.notify_one();
+    }
+
+    SubmitReady(ready);
+}
+
+void ServiceScheduler::SubmitReady(const vector<size_t>& ready)
+{
+    // Must not hold the lock here, a pool without workers runs jobs inline
+    for (size_t index : ready)
+    {
+        if (nodes_[index].access.main_thread)
+        {
+            {
+                std::lock_guard lock(mutex_);
+                main_queue_.push_back(index);
+            }
+
+            main_cv_.notify_one();
+        }
+        else
+        {
+            job_system_->Submit([this, index]() { RunNode(index); });
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <object_ptr.hpp>
+#include <vector>
+
+#include "engine/core/jobs/JobSystem.h"
+#include "engine/service/Service.h"
+
+/**
+ * Runs service updates as a dependency graph built from each service's
+ * ServiceAccess. When two services conflict, the one registered first runs
+ * first, so the results match the old sequential order.
+ */
+class ServiceScheduler
+{
+  public:
+    ServiceScheduler();
+
+    void Build(const std::vector<Service*>& services, JobSystem& job_system);
+    void Update(const FrameContext& frame);
+
+  private:
+    struct Node
+    {
+        Service* service;
+        ServiceAccess access;
+        std::vector<size_t> dependents;
+        uint32_t dependency_count;
+        uint32_t remaining;
+    };
+
+    jss::object_ptr<JobSystem> job_system_;
+    jss::object_ptr<const FrameContext> frame_;
+    std::vector<Node> nodes_;
+    std::deque<size_t> main_queue_;
+    size_t completed_;
+
+    std::mutex mutex_;
+    std::condition_variable main_cv_;
+
+    void RunNode(size_t index);
+    void SubmitReady(const std::vector<size_t>& ready);
+};
@@ -8,6 +8,8 @@
 #include <fstream>
 #include <glm/glm.hpp>
 #include <iostream>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <sstream>
 #include <unordered_set>
@@ -28,6 +30,8 @@ using std::string;
 using std::vector;
 
 static vector<CheckpointEntry> kCheckpoints;
+static std::optional<vector<CheckpointEntry>> kPreparedCheckpoints;
+static std::mutex kPreparedCheckpointsMutex;
 static vec3 kDefaultCheckpointSize = vec3(70.0f, 10.0f, 10.0f);
 static const string kCheckpointFilePath = "resources/scene/checkpoints.jsonc";
 
@@ -44,7 +48,7 @@ bool CheckpointEntry::Deserialize(const Value& node)
     return status;
 }
 
-void Checkpoints::LoadCheckpointFile()
+static vector<CheckpointEntry> ParseCheckpointFile()
 {
     /*
     // Used for converting obj checkpoint format to JSON
@@ -82,7 +86,7 @@ void Checkpoints::LoadCheckpointFile()
     ofile.close();
     */
 
-    kCheckpoints.clear();
+    vector<CheckpointEntry> checkpoints;
 
     std::ifstream file_stream(kCheckpointFilePath);
     ASSERT_MSG(file_stream.is_open(), "Failed to open checkpoint file");
@@ -121,10 +125,35 @@ void Checkpoints::LoadCheckpointFile()
         bool status = entry.Deserialize(*value);
         ASSERT(status);
 
-        kCheckpoints.push_back(entry);
+        checkpoints.push_back(entry);
+    }
+
+    debug::LogInfo("Loaded {} checkpoints from file", checkpoints.size());
+    return checkpoints;
+}
+
+void Checkpoints::LoadCheckpointFile()
+{
+    {
+        std::lock_guard lock(kPreparedCheckpointsMutex);
+
+        if (kPreparedCheckpoints)
+        {
+            kCheckpoints = std::move(kPreparedCheckpoints.value());
+            kPreparedCheckpoints.reset();
+            return;
+        }
     }
 
-    debug::LogInfo("Loaded {} checkpoints from file", kCheckpoints.size());
+    kCheckpoints = ParseCheckpointFile();
+}
+
+void Checkpoints::PrepareCheckpointFile()
+{
+    vector<CheckpointEntry> checkpoints = ParseCheckpointFile();
+
+    std::lock_guard lock(kPreparedCheckpointsMutex);
+    kPreparedCheckpoints = std::move(checkpoints);
 }
 
 const vector<CheckpointEntry>& Checkpoints::GetCheckpoints()
@@ -16,5 +16,12 @@ class Checkpoints
 {
   public:
     static void LoadCheckpointFile();
+
+    /**
+     * Parses the checkpoint file without publishing it, so it can run on a
+     * worker while the current checkpoints are still in use. The next
+     * LoadCheckpointFile picks up the result
+     */
+    static void PrepareCheckpointFile();
     static const std::vector<CheckpointEntry>& GetCheckpoints();
 };
\ No newline at end of file
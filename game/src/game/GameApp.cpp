@@ -17,11 +17,14 @@
 #include "engine/physics/PlaneStaticBody.h"
 #include "engine/physics/SphereRigidBody.h"
 #include "engine/pickup/PickupService.h"
+#include "engine/prefab/PrefabService.h"
+#include "engine/profiling/ProfilerService.h"
 #include "engine/render/Camera.h"
 #include "engine/render/MeshRenderer.h"
 #include "engine/render/RenderService.h"
 #include "engine/scene/ComponentUpdateService.h"
 #include "engine/scene/Scene.h"
+#include "engine/scene/SceneSnapshotService.h"
 #include "engine/scene/ScenedebugService.h"
 #include "engine/scene/Transform.h"
 #include "game/components/Controllers/AIController.h"
@@ -40,10 +43,13 @@
 #include "game/components/shooting/Shooter.h"
 #include "game/components/state/PlayerState.h"
 #include "game/components/ui/HowToPlay.h"
+#include "game/components/ui/LoadingScreen.h"
 #include "game/components/ui/MainMenu.h"
 #include "game/components/ui/PlayerHud.h"
 #include "game/components/ui/Powerups.h"
 #include "game/components/ui/Setting.h"
+#include "game/GamePrefabs.h"
+#include "game/GameSystems.h"
 #include "game/services/GameStateService.h"
 
 using glm::ivec2;
@@ -51,7 +57,7 @@ using glm::vec3;
 using std::make_unique;
 using std::string;
 
-GameApp::GameApp()
+GameApp::GameApp(const AppOptions& options) : App(options)
 {
 }
 
@@ -63,15 +69,34 @@ GameApp::GameApp()
  */
 void GameApp::OnInit()
 {
+    if (IsHeadless())
+    {
+        // Simulation only, anything that needs a window or GL is left out
+        AddService<AssetService>();
+        AddService<PrefabService>();
+        AddService<InputService>();
+        AddService<PhysicsService>();
+        AddService<ComponentUpdateService>();
+    AddService<SceneSnapshotService>();
+        AddService<AudioService>();
+        AddService<AIService>();
+        AddService<GameStateService>();
+        AddService<PickupService>();
+        return;
+    }
+
     GetWindow().SetSize(ivec2(1600, 900));
     GetWindow().SetTitle("Angry Wheels");
     GetWindow().SetIcon("resources/icon/icon.png");
 
     AddService<AssetService>();
+    AddService<PrefabService>();
     AddService<SceneDebugService>();
+    AddService<ProfilerService>();
     AddService<InputService>();
     AddService<PhysicsService>();
     AddService<ComponentUpdateService>();
+    AddService<SceneSnapshotService>();
     AddService<RenderService>();
     AddService<AudioService>();
     AddService<GuiService>();
@@ -86,13 +111,28 @@ void GameApp::OnInit()
  */
 void GameApp::OnStart()
 {
+    RegisterGameSystems(
+        GetServiceProvider().GetService<ComponentUpdateService>());
+    RegisterGameSnapshots(
+        GetServiceProvider().GetService<SceneSnapshotService>());
+    LoadGamePrefabs(GetServiceProvider().GetService<PrefabService>());
+
     AddScene("Test");
     AddScene("Track1");
     AddScene("MainMenu");
     AddScene("HowToPlay");
     AddScene("Powerups");
     AddScene("Setting");
+    AddScene("Loading");
+
+    if (IsHeadless())
+    {
+        // Skip the menus and go straight into an AI-only race
+        SetActiveScene("Track1");
+        return;
+    }
 
+    SetLoadingScene("Loading");
     SetActiveScene("MainMenu");
 
     auto* audio_service = &GetServiceProvider().GetService<AudioService>();
@@ -128,6 +168,24 @@ void GameApp::OnSceneLoaded(Scene& scene)
     {
         LoadSettingScene(scene);
     }
+    else if (scene_name == "Loading")
+    {
+        LoadLoadingScene(scene);
+    }
+}
+
+/**
+ * Runs on a worker thread before the scene is loaded, while the previous or
+ * loading scene is still active
+ */
+void GameApp::OnScenePrepare(const string& scene_name)
+{
+    if (scene_name == "Track1")
+    {
+        auto& physics_service =
+            GetServiceProvider().GetService<PhysicsService>();
+        physics_service.PrepareTriangleMesh("track3-collision");
+    }
 }
 
 void GameApp::LoadTestScene(Scene& scene)
@@ -301,117 +359,19 @@ void GameApp::LoadTrack1Scene(Scene& scene)
 {
     debug::LogInfo("Loading entities for Track1 scene...");
 
-    AssetService& asset_service_ =
-        GetServiceProvider().GetService<AssetService>();
-
-    {
-        // Debug camera
-        Entity& entity = scene.AddEntity("DebugCamera");
-        entity.AddComponent<Transform>();
-
-        // Camera disabled by default
-        auto& camera = entity.AddComponent<Camera>();
-        camera.SetType(CameraType::kDisabled);
-
-        entity.AddComponent<DebugCameraController>();
-    }
-
+    if (IsHeadless())
     {
-        // Track part with collision
+        // Only the collision mesh matters when nothing is being rendered
         auto& entity = scene.AddEntity("Track-Main");
-
-        auto& transform = entity.AddComponent<Transform>();
-        transform.SetPosition(vec3(0.0f, 0.0f, 0.0f));
+        entity.AddComponent<Transform>();
 
         auto& static_body = entity.AddComponent<MeshStaticBody>();
         static_body.SetMesh("track3-collision", 1.0f);
-
-        auto& mesh_renderer = entity.AddComponent<MeshRenderer>();
-        mesh_renderer.SetMeshes({
-            {
-                &asset_service_.GetMesh("track3@OrangeTrack"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@OrangeTrack"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-            {
-                &asset_service_.GetMesh("track3@BlueTrack"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@BlueTrack"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-        });
+        return;
     }
 
-    {
-        // Decorative track parts
-        auto& entity = scene.AddEntity("Track-Decorative");
-
-        auto& transform = entity.AddComponent<Transform>();
-        transform.SetPosition(vec3(0.0f, 0.0f, 0.0f));
-
-        auto& mesh_renderer = entity.AddComponent<MeshRenderer>();
-        mesh_renderer.SetMeshes({
-            {
-                &asset_service_.GetMesh("track3@Blocks"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@Blocks"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-            {
-                &asset_service_.GetMesh("track3@Globe"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@Globe"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-            {
-                &asset_service_.GetMesh("track3@Screen"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@Screen"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-            {
-                &asset_service_.GetMesh("track3@Rings2"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@Rings"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-            {
-                &asset_service_.GetMesh("track3@Rings6"),
-                MaterialProperties{
-                    .albedo_texture =
-                        &asset_service_.GetTexture("track3@Rings"),
-                    .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                    .specular = vec3(1.0f, 1.0f, 1.0f),
-                    .shininess = 64.0f,
-                },
-            },
-        });
-    }
+    auto& prefab_service = GetServiceProvider().GetService<PrefabService>();
+    prefab_service.Instantiate(scene, "track1");
 }
 
 void GameApp::LoadMainMenuScene(Scene& scene)
@@ -445,3 +405,12 @@ void GameApp::LoadSettingScene(Scene& scene)
     Entity& entity = scene.AddEntity("Setting");
     entity.AddComponent<Setting>();
 }
+
+
+void GameApp::LoadLoadingScene(Scene& scene)
+{
+    debug::LogInfo("Loading entities for Loading scene...");
+
+    Entity& entity = scene.AddEntity("LoadingScreen");
+    entity.AddComponent<LoadingScreen>();
+}
\ No newline at end of file
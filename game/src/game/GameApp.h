@@ -6,13 +6,14 @@
 class GameApp : public App
 {
   public:
-    GameApp();
+    GameApp(const AppOptions& options = {});
 
   protected:
     // From App
     void OnInit() override;
     void OnStart() override;
     void OnSceneLoaded(Scene& scene) override;
+    void OnScenePrepare(const std::string& scene_name) override;
 
   private:
     void LoadTestScene(Scene& scene);
@@ -21,4 +22,5 @@ class GameApp : public App
     void LoadHowToPlayScene(Scene& scene);
     void LoadPowerupsScene(Scene& scene);
     void LoadSettingScene(Scene& scene);
+    void LoadLoadingScene(Scene& scene);
 };
@@ -0,0 +1,142 @@
+#include "game/GamePrefabs.h"
+
+#include <rapidjson/document.h>
+
+#include "engine/core/json/deserialize_utils.h"
+#include "engine/prefab/PrefabService.h"
+#include "game/components/Controllers/AIController.h"
+#include "game/components/Controllers/PlayerController.h"
+#include "game/components/DebugCameraController.h"
+#include "game/components/FollowCamera.h"
+#include "game/components/Pickups/AmmoType/BuckshotPickup.h"
+#include "game/components/Pickups/AmmoType/DoubleDamagePickup.h"
+#include "game/components/Pickups/AmmoType/ExploadingBulletPickup.h"
+#include "game/components/Pickups/AmmoType/IncreaseFireRatePickup.h"
+#include "game/components/Pickups/AmmoType/VampireBulletPickup.h"
+#include "game/components/Pickups/Powerups/DisableHandlingPickup.h"
+#include "game/components/Pickups/Powerups/EveryoneSlowerPickup.h"
+#include "game/components/Pickups/Powerups/IncreaseAimBoxPickup.h"
+#include "game/components/Pickups/Powerups/KillAbilitiesPickup.h"
+#include "game/components/VehicleComponent.h"
+#include "game/components/audio/AudioEmitter.h"
+#include "game/components/audio/AudioListener.h"
+#include "game/components/race/Checkpoint.h"
+#include "game/components/shooting/Hitbox.h"
+#include "game/components/shooting/Shooter.h"
+#include "game/components/state/PlayerState.h"
+#include "game/components/ui/PlayerHud.h"
+
+using glm::vec3;
+using rapidjson::Value;
+
+/* ----- VehicleComponent ----- */
+
+static void InstantiateVehicle(Entity& entity, PrefabReader& reader,
+                               const PrefabContext& context)
+{
+    // The PhysX actor is named after the entity, and placed at its transform
+    auto& vehicle = entity.AddComponent<VehicleComponent>();
+    vehicle.SetVehicleName(entity.GetName());
+}
+
+/* ----- Hitbox ----- */
+
+static bool CompileHitbox(const Value& node, PrefabWriter& writer)
+{
+    vec3 size(0.0f);
+    const bool has_size = json::GetVec3(node, "size", size);
+
+    if (!has_size && node.HasMember("size"))
+    {
+        return false;
+    }
+
+    writer.Write(has_size);
+    writer.Write(size);
+    return true;
+}
+
+static void InstantiateHitbox(Entity& entity, PrefabReader& reader,
+                              const PrefabContext& context)
+{
+    const auto has_size = reader.Read<bool>();
+    const auto size = reader.Read<vec3>();
+
+    auto& hitbox = entity.AddComponent<Hitbox>();
+
+    if (has_size)
+    {
+        hitbox.SetSize(size);
+    }
+}
+
+/* ----- FollowCamera ----- */
+
+static bool CompileFollowCamera(const Value& node, PrefabWriter& writer)
+{
+    // Index of the followed entity within the same prefab
+    Value::ConstMemberIterator iter = node.FindMember("target");
+
+    if (iter == node.MemberEnd() || !iter->value.IsUint() ||
+        !writer.CheckEntityIndex(iter->value.GetUint()))
+    {
+        return false;
+    }
+
+    writer.Write<uint32_t>(iter->value.GetUint());
+    return true;
+}
+
+static void InstantiateFollowCamera(Entity& entity, PrefabReader& reader,
+                                    const PrefabContext& context)
+{
+    Entity& target = context.GetEntity(reader.Read<uint32_t>());
+
+    auto& follow_camera = entity.AddComponent<FollowCamera>();
+    follow_camera.SetFollowingTransform(target);
+
+    if (auto* player_state = target.TryGetComponent<PlayerState>())
+    {
+        follow_camera.SetPlayerState(*player_state);
+    }
+}
+
+void LoadGamePrefabs(PrefabService& prefab_service)
+{
+    prefab_service.RegisterComponent("VehicleComponent", nullptr,
+                                     &InstantiateVehicle);
+    prefab_service.RegisterComponent("Hitbox", &CompileHitbox,
+                                     &InstantiateHitbox);
+    prefab_service.RegisterComponent("FollowCamera", &CompileFollowCamera,
+                                     &InstantiateFollowCamera);
+
+    prefab_service.RegisterComponent<AudioEmitter>("AudioEmitter");
+    prefab_service.RegisterComponent<AudioListener>("AudioListener");
+    prefab_service.RegisterComponent<PlayerState>("PlayerState");
+    prefab_service.RegisterComponent<Shooter>("Shooter");
+    prefab_service.RegisterComponent<PlayerController>("PlayerController");
+    prefab_service.RegisterComponent<AIController>("AIController");
+    prefab_service.RegisterComponent<PlayerHud>("PlayerHud");
+    prefab_service.RegisterComponent<DebugCameraController>(
+        "DebugCameraController");
+    prefab_service.RegisterComponent<Checkpoint>("Checkpoint");
+
+    prefab_service.RegisterComponent<BuckshotPickup>("BuckshotPickup");
+    prefab_service.RegisterComponent<DoubleDamagePickup>("DoubleDamagePickup");
+    prefab_service.RegisterComponent<ExploadingBulletPickup>(
+        "ExploadingBulletPickup");
+    prefab_service.RegisterComponent<IncreaseFireRatePickup>(
+        "IncreaseFireRatePickup");
+    prefab_service.RegisterComponent<VampireBulletPickup>(
+        "VampireBulletPickup");
+    prefab_service.RegisterComponent<DisableHandlingPickup>(
+        "DisableHandlingPickup");
+    prefab_service.RegisterComponent<EveryoneSlowerPickup>(
+        "EveryoneSlowerPickup");
+    prefab_service.RegisterComponent<IncreaseAimBoxPickup>(
+        "IncreaseAimBoxPickup");
+    prefab_service.RegisterComponent<KillAbilitiesPickup>(
+        "KillAbilitiesPickup");
+
+    prefab_service.LoadPrefabs();
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+class PrefabService;
+
+// Registers the game's components with the service, then compiles every prefab
+void LoadGamePrefabs(PrefabService& prefab_service);
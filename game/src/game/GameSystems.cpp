@@ -0,0 +1,74 @@
+#include "game/GameSystems.h"
+
+#include "engine/scene/ComponentUpdateService.h"
+#include "engine/scene/SceneSnapshotService.h"
+#include "game/components/Controllers/AIController.h"
+#include "game/components/Controllers/PlayerController.h"
+#include "game/components/DebugCameraController.h"
+#include "game/components/FollowCamera.h"
+#include "game/components/Pickups/AmmoType/BuckshotPickup.h"
+#include "game/components/Pickups/AmmoType/DoubleDamagePickup.h"
+#include "game/components/Pickups/AmmoType/ExploadingBulletPickup.h"
+#include "game/components/Pickups/AmmoType/IncreaseFireRatePickup.h"
+#include "game/components/Pickups/AmmoType/VampireBulletPickup.h"
+#include "game/components/Pickups/Powerups/DisableHandlingPickup.h"
+#include "game/components/Pickups/Powerups/EveryoneSlowerPickup.h"
+#include "game/components/Pickups/Powerups/IncreaseAimBoxPickup.h"
+#include "game/components/Pickups/Powerups/KillAbilitiesPickup.h"
+#include "game/components/VehicleComponent.h"
+#include "game/components/audio/AudioEmitter.h"
+#include "game/components/shooting/Hitbox.h"
+#include "game/components/shooting/Shooter.h"
+#include "game/components/state/PlayerState.h"
+
+/**
+ * A component's OnUpdate isn't virtual or an event handler, its system here is
+ * the only thing that calls it, once per simulation tick. Adding a component
+ * with an OnUpdate that isn't registered below asserts
+ */
+void RegisterGameSystems(ComponentUpdateService& component_updates)
+{
+    // Controllers set this tick's commands before anything acts on them
+    component_updates.RegisterSystem<PlayerController>(SystemStage::kInput);
+    component_updates.RegisterSystem<AIController>(SystemStage::kInput);
+    component_updates.RegisterSystem<DebugCameraController>(
+        SystemStage::kInput);
+
+    component_updates.RegisterSystem<VehicleComponent>(SystemStage::kGameplay);
+    component_updates.RegisterSystem<Shooter>(SystemStage::kGameplay);
+    component_updates.RegisterSystem<Hitbox>(SystemStage::kGameplay);
+    component_updates.RegisterSystem<PlayerState>(SystemStage::kGameplay);
+
+    // One system per concrete pickup, so none of them update through Pickup
+    component_updates.RegisterSystem<BuckshotPickup>(SystemStage::kGameplay);
+    component_updates.RegisterSystem<DoubleDamagePickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<ExploadingBulletPickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<IncreaseFireRatePickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<VampireBulletPickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<DisableHandlingPickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<EveryoneSlowerPickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<IncreaseAimBoxPickup>(
+        SystemStage::kGameplay);
+    component_updates.RegisterSystem<KillAbilitiesPickup>(
+        SystemStage::kGameplay);
+
+    component_updates.RegisterSystem<FollowCamera>(SystemStage::kPresentation);
+    component_updates.RegisterSystem<AudioEmitter>(SystemStage::kPresentation);
+}
+
+void RegisterGameSnapshots(SceneSnapshotService& snapshots)
+{
+    snapshots.RegisterComponent<VehicleComponent>();
+    snapshots.RegisterComponent<PlayerState>();
+    snapshots.RegisterComponent<Shooter>();
+    snapshots.RegisterComponent<AIController>();
+
+    // Captures every concrete pickup, they all keep their state in Pickup
+    snapshots.RegisterComponent<Pickup>();
+}
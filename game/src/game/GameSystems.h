@@ -0,0 +1,10 @@
+#pragma once
+
+class ComponentUpdateService;
+class SceneSnapshotService;
+
+// Registers every game component that updates once per tick, in run order
+void RegisterGameSystems(ComponentUpdateService& component_updates);
+
+// Registers every game component whose state is reset on a race restart
+void RegisterGameSnapshots(SceneSnapshotService& snapshots);
@@ -8,10 +8,10 @@
 #include "engine/core/math/Physx.h"
 #include "engine/core/math/Random.h"
 #include "engine/input/InputService.h"
-#include "engine/physics/PhysicsService.h"
 #include "engine/pickup/PickupService.h"
 #include "engine/render/RenderService.h"
 #include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
 #include "engine/scene/Transform.h"
 #include "game/components/VehicleComponent.h"
 #include "game/components/shooting/Shooter.h"
@@ -29,8 +29,9 @@ static constexpr float kMaxFreeFallDifference(500.0f);
 static constexpr float kMinRespawnSpeed(8.0f);
 static constexpr double kMaxCheckpointMissedTimer(5.f);
 
-// distance that AI can "see"; shoots when a target is within view
+// cone that AI can "see" in; shoots when another kart is within view
 static constexpr float kViewDistance(300.f);
+static const float kViewHalfAngle(glm::radians(4.0f));
 
 AIController::AIController()
     : input_service_(nullptr),
@@ -46,21 +47,15 @@ void AIController::OnInit(const ServiceProvider& service_provider)
     input_service_ = &service_provider.GetService<InputService>();
     ai_service_ = &service_provider.GetService<AIService>();
     transform_ = &GetEntity().GetComponent<Transform>();
-    render_service_ = &service_provider.GetService<RenderService>();
+    render_service_ = service_provider.TryGetService<RenderService>();
     game_state_service_ = &service_provider.GetService<GameStateService>();
-    physics_service_ = &service_provider.GetService<PhysicsService>();
     pickup_service_ = &service_provider.GetService<PickupService>();
 
     // component dependencies
     vehicle_ = &GetEntity().GetComponent<VehicleComponent>();
     shooter_ = &GetEntity().GetComponent<Shooter>();
 
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
-
-    if (GetEntity().HasComponent<PlayerState>())
-    {
-        player_state_ = &GetEntity().GetComponent<PlayerState>();
-    }
+    player_state_ = GetEntity().TryGetComponent<PlayerState>();
 
     path_to_follow_ = ai_service_->GetPath();
     path_traced_.insert(next_path_index_);
@@ -145,21 +140,32 @@ void AIController::OnUpdate(const Timestep& delta_time)
     }
     PowerupDecision();
 
-    // note: raycasting *may* be an expensive approach
-    const vec3& forward = transform_->GetForwardDirection();
-    const vec3 offset = 20.0f * forward;
-    const vec3 origin = transform_->GetPosition() + offset;
-
-    // if an entity is within view
-    const bool saw_something =
-        physics_service_->RaycastDynamic(origin, forward, kViewDistance)
-            .has_value();
-    if (saw_something && WillShoot(0.75f))
+    if (CanSeeTarget() && WillShoot(0.75f))
     {
         CheckShoot(delta_time);
     }
 }
 
+bool AIController::CanSeeTarget()
+{
+    const Entity& self = GetEntity();
+    bool saw_target = false;
+
+    // Looked up in the scene's grid instead of raycasting every tick
+    self.GetScene().GetSpatialIndex().ForEachInCone(
+        transform_->GetPosition(), transform_->GetForwardDirection(),
+        kViewDistance, kViewHalfAngle,
+        [&](Entity& entity)
+        {
+            if (&entity != &self && entity.HasComponent<VehicleComponent>())
+            {
+                saw_target = true;
+            }
+        });
+
+    return saw_target;
+}
+
 void AIController::FixRespawnOrientation(const vec3& next_checkpoint,
                                          const vec3& last_checkpoint)
 {
@@ -278,6 +284,11 @@ void AIController::ExecutePowerup()
 
 void AIController::DrawDebugLine(vec3 from, vec3 to)
 {
+    if (!render_service_)
+    {
+        return;
+    }
+
     render_service_->GetDebugDrawList().AddLine(DebugVertex(from),
                                                 DebugVertex(to));
 }
@@ -398,6 +409,37 @@ void AIController::ResetForNextLap()
     path_traced_.insert(next_path_index_);
 }
 
+AIController::SnapshotState AIController::SaveSnapshot() const
+{
+    return SnapshotState{
+        .speed_multiplier = speed_multiplier_,
+        .shoot_cooldown = shoot_cooldown_,
+        .handling_multiplier = handling_multiplier_,
+        .respawn_tracker = respawn_tracker_,
+        .minimum_threshold_respawn_timer = minimum_threshold_respawn_timer_,
+        .next_path_index = next_path_index_,
+        .path_traced = path_traced_,
+        .respawn_timer_missed_checkpoint = respawn_timer_missed_checkpoint_,
+        .b_respawn_timer_missed_checkpoint =
+            b_respawn_timer_missed_checkpoint_,
+        .respawn_timer_min_speed = respawn_timer_min_speed};
+}
+
+void AIController::RestoreSnapshot(const SnapshotState& state)
+{
+    speed_multiplier_ = state.speed_multiplier;
+    shoot_cooldown_ = state.shoot_cooldown;
+    handling_multiplier_ = state.handling_multiplier;
+    respawn_tracker_ = state.respawn_tracker;
+    minimum_threshold_respawn_timer_ = state.minimum_threshold_respawn_timer;
+    next_path_index_ = state.next_path_index;
+    path_traced_ = state.path_traced;
+    respawn_timer_missed_checkpoint_ = state.respawn_timer_missed_checkpoint;
+    b_respawn_timer_missed_checkpoint_ =
+        state.b_respawn_timer_missed_checkpoint;
+    respawn_timer_min_speed = state.respawn_timer_min_speed;
+}
+
 // starting the timer to carry out the respawning logic
 void AIController::SetRespawnLastCheckpointTimer(bool b_value)
 {
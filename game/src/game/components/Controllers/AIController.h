@@ -3,28 +3,45 @@
 #include <object_ptr.hpp>
 #include <set>
 
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/physics/VehicleCommands.h"  // to get the command struct
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "game/FwdGame.h"
 #include "game/components/state/PlayerState.h"
 
 class PickupService;
 class Shooter;
 
-class AIController final : public Component,
-                           public IEventSubscriber<OnUpdateEvent>
+class AIController final : public Component
 {
   public:
+    struct SnapshotState
+    {
+        float speed_multiplier;
+        float shoot_cooldown;
+        float handling_multiplier;
+        bool respawn_tracker;
+        double minimum_threshold_respawn_timer;
+        int next_path_index;
+        std::set<int> path_traced;
+        double respawn_timer_missed_checkpoint;
+        bool b_respawn_timer_missed_checkpoint;
+        double respawn_timer_min_speed;
+    };
+
     AIController();
     // From Component
     void OnInit(const ServiceProvider& service_provider) override;
-    void OnUpdate(const Timestep& delta_time) override;
     std::string_view GetName() const override;
+
+    void OnUpdate(const Timestep& delta_time);
     void ResetForNextLap();
 
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     // RESPAWN
 
     // starting the timer to carry out the respawning logic
@@ -34,12 +51,14 @@ class AIController final : public Component,
     bool GetRespawnLastCheckpointTimer();
 
   private:
+    // Lets game_bench drive waypoint selection without a full kart
+    friend class AIControllerBenchmark;
+
     jss::object_ptr<Transform> transform_;
     jss::object_ptr<InputService> input_service_;
     jss::object_ptr<AIService> ai_service_;
     jss::object_ptr<RenderService> render_service_;
     jss::object_ptr<GameStateService> game_state_service_;
-    jss::object_ptr<PhysicsService> physics_service_;
     jss::object_ptr<PickupService> pickup_service_;
 
     jss::object_ptr<Shooter> shooter_;
@@ -79,6 +98,7 @@ class AIController final : public Component,
     /// @brief will randomly determine whether the AI will shoot or not.
     ///   the higher the chance, the more likely it shoots.
     bool WillShoot(float chance = 0.5f);
+    bool CanSeeTarget();
     void CheckShoot(const Timestep& delta_time);
 
     // respawn handling
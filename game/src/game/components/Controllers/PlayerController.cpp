@@ -37,8 +37,6 @@ void PlayerController::OnInit(const ServiceProvider& service_provider)
     player_state_ = &GetEntity().GetComponent<PlayerState>();
     vehicle_ = &GetEntity().GetComponent<VehicleComponent>();
     shooter_ = &GetEntity().GetComponent<Shooter>();
-
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void PlayerController::OnUpdate(const Timestep& delta_time)
@@ -2,28 +2,28 @@
 
 #include <object_ptr.hpp>
 
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/physics/VehicleCommands.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "game/FwdGame.h"
 #include "game/components/shooting/Shooter.h"
 
 class PickupService;
 class AudioService;
 
-class PlayerController final : public Component,
-                               public IEventSubscriber<OnUpdateEvent>
+class PlayerController final : public Component
 {
   public:
     /* ----- from component ----- */
 
     void OnInit(const ServiceProvider& service_provider) override;
-    void OnUpdate(const Timestep& delta_time) override;
     void OnDebugGui() override;
     std::string_view GetName() const override;
 
+    void OnUpdate(const Timestep& delta_time);
+
   private:
     jss::object_ptr<Transform> transform_;
     jss::object_ptr<InputService> input_service_;
@@ -35,9 +35,6 @@ void DebugCameraController::OnInit(const ServiceProvider& service_provider)
     // Components
     transform_ = &GetEntity().GetComponent<Transform>();
     camera_ = &GetEntity().GetComponent<Camera>();
-
-    // Events
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 string_view DebugCameraController::GetName() const
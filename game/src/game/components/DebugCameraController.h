@@ -2,14 +2,13 @@
 
 #include <optional>
 
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdComponents.h"
 #include "engine/input/InputService.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "engine/scene/Transform.h"
 
-class DebugCameraController final : public Component,
-                                    public IEventSubscriber<OnUpdateEvent>
+class DebugCameraController final : public Component
 {
   public:
     DebugCameraController();
@@ -18,8 +17,7 @@ class DebugCameraController final : public Component,
     void OnInit(const ServiceProvider& service_provider) override;
     std::string_view GetName() const override;
 
-    // From IEventSubscriber<OnUpdateEvent>
-    void OnUpdate(const Timestep& delta_time) override;
+    void OnUpdate(const Timestep& delta_time);
 
   private:
     jss::object_ptr<Transform> transform_;
@@ -5,6 +5,7 @@
 #include "engine/core/debug/Log.h"
 #include "engine/core/gui/PropertyWidgets.h"
 #include "engine/input/InputService.h"
+#include "engine/physics/PhysicsService.h"
 #include "engine/render/Camera.h"
 #include "engine/render/RenderService.h"
 #include "engine/scene/Entity.h"
@@ -38,9 +39,7 @@ void FollowCamera::OnInit(const ServiceProvider& service_provider)
     // Dependencies
     transform_ = &GetEntity().GetComponent<Transform>();
     camera_ = &GetEntity().GetComponent<Camera>();
-
-    // Event subscriptions
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
+    physics_service_ = &service_provider.GetService<PhysicsService>();
 }
 
 void FollowCamera::SetFollowingTransform(Entity& entity)
@@ -61,12 +60,16 @@ void FollowCamera::OnUpdate(const Timestep& delta_time)
         return;
     }
 
+    // Follow the pose the target is drawn at, not its latest physics tick
+    const vec3 following_position = target_transform_->GetInterpolatedPosition(
+        physics_service_->GetInterpolationAlpha());
+
     // Calculate the target position with offset and distance
     vec3 camera_position =
-        target_transform_->GetPosition() +
+        following_position +
         target_transform_->GetForwardDirection() * -distance_ + offset_;
 
-    vec3 target_position = target_transform_->GetPosition() + lookat_offset_;
+    vec3 target_position = following_position + lookat_offset_;
 
     const float dt_sec = static_cast<float>(delta_time.GetSeconds());
 
@@ -3,17 +3,17 @@
 #include <glm/glm.hpp>
 #include <object_ptr.hpp>
 
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 
 class RenderService;
 class InputService;
 class VehicleComponent;
 class PlayerState;
 
-class FollowCamera : public Component, public IEventSubscriber<OnUpdateEvent>
+class FollowCamera final : public Component
 {
   public:
     FollowCamera();
@@ -23,8 +23,7 @@ class FollowCamera : public Component, public IEventSubscriber<OnUpdateEvent>
     void OnDebugGui() override;
     std::string_view GetName() const override;
 
-    // From IEventSubscriber<OnUpdateEvent>
-    void OnUpdate(const Timestep& delta_time) override;
+    void OnUpdate(const Timestep& delta_time);
 
     // Set the entity from which we want to follow using this camera
     void SetFollowingTransform(Entity& entity);
@@ -37,6 +36,7 @@ class FollowCamera : public Component, public IEventSubscriber<OnUpdateEvent>
     jss::object_ptr<Transform> target_transform_;
     jss::object_ptr<VehicleComponent> target_vehicle_;
     jss::object_ptr<Camera> camera_;
+    jss::object_ptr<PhysicsService> physics_service_;
 
     // to get the player controller attached to the entity on which follow
     // camera is attached
@@ -6,7 +6,6 @@
 void BuckshotPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void BuckshotPickup::OnTriggerEnter(const OnTriggerEvent& data)
@@ -6,7 +6,6 @@
 void DoubleDamagePickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void DoubleDamagePickup::OnTriggerEnter(const OnTriggerEvent& data)
@@ -6,7 +6,6 @@
 void ExploadingBulletPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void ExploadingBulletPickup::OnTriggerEnter(const OnTriggerEvent& data)
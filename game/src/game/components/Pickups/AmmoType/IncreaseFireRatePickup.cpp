@@ -6,7 +6,6 @@
 void IncreaseFireRatePickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void IncreaseFireRatePickup::OnTriggerEnter(const OnTriggerEvent& data)
@@ -6,7 +6,6 @@
 void VampireBulletPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void VampireBulletPickup::OnTriggerEnter(const OnTriggerEvent& data)
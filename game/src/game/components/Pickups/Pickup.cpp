@@ -20,8 +20,6 @@ void Pickup::OnInit(const ServiceProvider& service_provider)
         ammo_types_ = pickup_service_->GetAmmoPickupNames();
         powerup_types_ = pickup_service_->GetPowerupPickupNames();
     }
-
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void Pickup::OnStart()
@@ -34,11 +32,33 @@ void Pickup::OnTriggerEnter(const OnTriggerEvent& data)
 
 void Pickup::OnUpdate(const Timestep& delta_time)
 {
-    // rotate the powerup around its y axis
+    // PickupService spins every pickup in one pass
+}
+
+void Pickup::Spin(const Timestep& delta_time)
+{
     transform_->RotateEulerDegrees(
         glm::vec3(0.0f, kRotationSpeed * delta_time.GetSeconds(), 0.0f));
 }
 
+Pickup::SnapshotState Pickup::SaveSnapshot() const
+{
+    return SnapshotState{.power_visible = power_visible_,
+                         .timer = timer_,
+                         .start_timer = start_timer_,
+                         .deactivate_timer = deactivate_timer_,
+                         .start_deactivate_timer = start_deactivate_timer_};
+}
+
+void Pickup::RestoreSnapshot(const SnapshotState& state)
+{
+    power_visible_ = state.power_visible;
+    timer_ = state.timer;
+    start_timer_ = state.start_timer;
+    deactivate_timer_ = state.deactivate_timer;
+    start_deactivate_timer_ = state.start_deactivate_timer;
+}
+
 std::string_view Pickup::GetName() const
 {
     return "";
@@ -9,9 +9,9 @@
 #include <unordered_set>
 
 #include "PickupType.h"
+#include "engine/core/math/Timestep.h"
 #include "engine/pickup/PickupService.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "engine/scene/Transform.h"
 #include "game/components/state/PlayerState.h"
 #include "game/services/GameStateService.h"
@@ -19,16 +19,32 @@
 class PlayerState;
 class PickupService;
 
-class Pickup : public Component, public IEventSubscriber<OnUpdateEvent>
+class Pickup : public Component
 {
   public:
+    struct SnapshotState
+    {
+        bool power_visible;
+        double timer;
+        bool start_timer;
+        double deactivate_timer;
+        bool start_deactivate_timer;
+    };
+
     // From Component
     virtual void OnInit(const ServiceProvider& service_provider) override;
     virtual void OnStart();
     virtual void OnTriggerEnter(const OnTriggerEvent& data) override;
     virtual void OnTriggerExit(const OnTriggerEvent& data) override;
     virtual std::string_view GetName() const override;
-    virtual void OnUpdate(const Timestep& delta_time) override;
+
+    virtual void OnUpdate(const Timestep& delta_time);
+
+    // Rotates the pickup around its y axis, PickupService calls this
+    void Spin(const Timestep& delta_time);
+
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
 
   private:
     bool powerup_executed_ = false;
@@ -43,6 +59,14 @@ class Pickup : public Component, public IEventSubscriber<OnUpdateEvent>
     jss::object_ptr<Transform> transform_;
     bool power_visible_ = true;
 
+    // timer_ used to respawn the pickup some time after it's picked up
+    double timer_ = 0.f;
+    bool start_timer_ = false;
+
+    // deactivate_timer_ to remove the ammo powerup from user
+    double deactivate_timer_ = 0.f;
+    bool start_deactivate_timer_ = false;
+
     // Get the names from game service, to check for which pickup picked the car
     // up.
     std::unordered_set<std::string> k_player_names_;
@@ -6,7 +6,6 @@
 void DisableHandlingPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void DisableHandlingPickup::OnTriggerEnter(const OnTriggerEvent& data)
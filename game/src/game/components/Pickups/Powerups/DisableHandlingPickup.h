@@ -20,9 +20,4 @@ class DisableHandlingPickup final : public Pickup
     virtual void OnUpdate(const Timestep& delta_time) override;
     float GetMaxRespawnTime() override;
     float GetDeactivateTime() override;
-
-  private:
-    // timer_ used to deactivate the ammo powerup after some time.
-    double timer_ = 0.f;
-    bool start_timer_ = false;
 };
@@ -8,7 +8,6 @@
 void EveryoneSlowerPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void EveryoneSlowerPickup::OnTriggerEnter(const OnTriggerEvent& data)
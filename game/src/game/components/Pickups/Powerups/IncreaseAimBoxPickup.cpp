@@ -8,7 +8,6 @@
 void IncreaseAimBoxPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void IncreaseAimBoxPickup::OnTriggerEnter(const OnTriggerEvent& data)
@@ -6,7 +6,6 @@
 void KillAbilitiesPickup::OnInit(const ServiceProvider& service_provider)
 {
     Pickup::OnInit(service_provider);
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 void KillAbilitiesPickup::OnTriggerEnter(const OnTriggerEvent& data)
@@ -9,8 +9,10 @@
 
 #include <glm/geometric.hpp>
 #include <glm/glm.hpp>
+#include <mutex>
 
 #include "engine/core/debug/Log.h"
+#include "engine/core/debug/Profiler.h"
 #include "engine/core/gui/PropertyWidgets.h"
 #include "engine/core/math/Physx.h"
 #include "engine/input/InputService.h"
@@ -44,6 +46,18 @@ static constexpr const char* kIntegrationParamFileName = "Integration.jsonc";
 static constexpr const char* kDrivingAudio = "kart_driving_01.ogg";
 static constexpr const char* kRespawnAudio = "kart_respawn_01.ogg";
 
+// Parsed parameter files, every vehicle uses the same ones
+struct VehicleParamCache
+{
+    std::mutex mutex;
+    bool loaded = false;
+    BaseVehicleParams base;
+    DirectDrivetrainParams direct_drive;
+    PhysXIntegrationParams integration;
+};
+
+static VehicleParamCache kParamCache;
+
 /* ----- From Component ----- */
 
 void VehicleComponent::OnInit(const ServiceProvider& service_provider)
@@ -52,7 +66,7 @@ void VehicleComponent::OnInit(const ServiceProvider& service_provider)
     physics_service_ = &service_provider.GetService<PhysicsService>();
     input_service_ = &service_provider.GetService<InputService>();
     game_state_service_ = &service_provider.GetService<GameStateService>();
-    render_service_ = &service_provider.GetService<RenderService>();
+    render_service_ = service_provider.TryGetService<RenderService>();
 
     transform_ = &GetEntity().GetComponent<Transform>();
     audio_emitter_ = &GetEntity().GetComponent<AudioEmitter>();
@@ -61,8 +75,7 @@ void VehicleComponent::OnInit(const ServiceProvider& service_provider)
     respawn_timer_ = 0.0f;
 
     // subscribe to events
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
-    GetEventBus().Subscribe<OnPhysicsUpdateEvent>(this);
+    ManageEventSub(GetEventBus().Subscribe<OnPhysicsUpdateEvent>(this));
 
     // init vehicle properties
     InitMaterialFrictionTable();
@@ -70,7 +83,10 @@ void VehicleComponent::OnInit(const ServiceProvider& service_provider)
     InitVehicle();
 
     physics_service_->RegisterVehicle(&vehicle_, &GetEntity());
-    exhaust_particles_ = &render_service_->GetParticleSystem("exhaust");
+    if (render_service_)
+    {
+        exhaust_particles_ = &render_service_->GetParticleSystem("exhaust");
+    }
     exhaust_delay_ = kExhaustParticleDelayMax;
 
     // init sounds
@@ -127,6 +143,7 @@ void VehicleComponent::OnDebugGui()
 
 void VehicleComponent::OnDestroy()
 {
+    Component::OnDestroy();
     physics_service_->UnregisterVehicle(&vehicle_, &GetEntity());
     vehicle_.destroy();
 }
@@ -137,22 +154,18 @@ void VehicleComponent::OnUpdate(const Timestep& delta_time)
 {
     if (input_service_->IsKeyPressed(GLFW_KEY_F10))
     {
-        LoadParams();
+        LoadParams(true);
         debug::LogInfo("Reloaded vehicle params from JSON files...");
     }
 
-    if (time_since_last_particle_ >= exhaust_delay_)
+    if (exhaust_particles_ && time_since_last_particle_ >= exhaust_delay_)
     {
+        // Offset is in kart space, mirrored for the right side
+        const vec3 mirror(-1.0f, 1.0f, 1.0f);
         const vec3 particle_pos_left =
-            transform_->GetPosition() +
-            transform_->GetRightDirection() * kExhaustParticleOffset.x +
-            transform_->GetUpDirection() * kExhaustParticleOffset.y +
-            transform_->GetForwardDirection() * kExhaustParticleOffset.z;
+            transform_->TransformPoint(kExhaustParticleOffset);
         const vec3 particle_pos_right =
-            transform_->GetPosition() +
-            -transform_->GetRightDirection() * kExhaustParticleOffset.x +
-            transform_->GetUpDirection() * kExhaustParticleOffset.y +
-            transform_->GetForwardDirection() * kExhaustParticleOffset.z;
+            transform_->TransformPoint(kExhaustParticleOffset * mirror);
 
         exhaust_particles_->Emit(particle_pos_left);
         exhaust_particles_->Emit(particle_pos_right);
@@ -177,10 +190,8 @@ void VehicleComponent::OnUpdate(const Timestep& delta_time)
 
     // We need it for the follow camera
     // get the player state
-    if (GetEntity().HasComponent<PlayerState>())
+    if (auto player_state = GetEntity().TryGetComponent<PlayerState>())
     {
-        jss::object_ptr<PlayerState> player_state =
-            &GetEntity().GetComponent<PlayerState>();
         player_state->SetCurrentSpeed(GetSpeed());
     }
 }
@@ -191,25 +202,59 @@ void VehicleComponent::OnPhysicsUpdate(const Timestep& step)
 
 /* ----- Vehicle Functions ----- */
 
-void VehicleComponent::LoadParams()
+void VehicleComponent::PreloadParams()
 {
-    const bool success_base = readBaseParamsFromJsonFile(
-        kVehicleDataPath, kBaseParamFileName, vehicle_.mBaseParams);
+    PROFILE_SCOPE("VehicleComponent::PreloadParams");
+
+    BaseVehicleParams base;
+    DirectDrivetrainParams direct_drive;
+    PhysXIntegrationParams integration;
+
+    const bool success_base =
+        readBaseParamsFromJsonFile(kVehicleDataPath, kBaseParamFileName, base);
     ASSERT_MSG(success_base,
                "Must be able to load vehicle base params from JSON file");
 
     const bool success_drivertrain = readDirectDrivetrainParamsFromJsonFile(
-        kVehicleDataPath, kDirectDriveParamFileName,
-        vehicle_.mBaseParams.axleDescription, vehicle_.mDirectDriveParams);
+        kVehicleDataPath, kDirectDriveParamFileName, base.axleDescription,
+        direct_drive);
     ASSERT_MSG(success_drivertrain,
                "Must be able to load vehicle drivetrain params from JSON file");
 
     const bool success_integration = readPhysxIntegrationParamsFromJsonFile(
-        kVehicleDataPath, kIntegrationParamFileName, vehicle_.mPhysXParams);
+        kVehicleDataPath, kIntegrationParamFileName, integration);
     ASSERT_MSG(
         success_integration,
         "Must be able to load vehicle integration params from JSON file");
 
+    std::lock_guard lock(kParamCache.mutex);
+    kParamCache.base = base;
+    kParamCache.direct_drive = direct_drive;
+    kParamCache.integration = integration;
+    kParamCache.loaded = true;
+}
+
+void VehicleComponent::LoadParams(bool reload)
+{
+    bool loaded;
+
+    {
+        std::lock_guard lock(kParamCache.mutex);
+        loaded = kParamCache.loaded;
+    }
+
+    if (reload || !loaded)
+    {
+        PreloadParams();
+    }
+
+    {
+        std::lock_guard lock(kParamCache.mutex);
+        vehicle_.mBaseParams = kParamCache.base;
+        vehicle_.mDirectDriveParams = kParamCache.direct_drive;
+        vehicle_.mPhysXParams = kParamCache.integration;
+    }
+
     setPhysXIntegrationParams(vehicle_.mBaseParams.axleDescription,
                               gPhysXMaterialFrictions_,
                               gNbPhysXMaterialFrictions_,
@@ -293,15 +338,9 @@ void VehicleComponent::HandleVehicleTransform()
 
     else
     {
+        // The pose itself is copied by PhysicsService after every tick
         vehicle_.mBaseState.rigidBodyState.linearVelocity =
             physx::PxVec3(max_velocity_);
-
-        const PxTransform& pose =
-            vehicle_.mPhysXState.physxActor.rigidBody->getGlobalPose();
-
-        const GlmTransform transform = PxToGlm(pose);
-        transform_->SetPosition(transform.position);
-        transform_->SetOrientation(transform.orientation);
     }
 }
 
@@ -342,6 +381,49 @@ void VehicleComponent::Respawn()
     debug::LogDebug("Entity {} respawned!", GetEntity().GetId());
 }
 
+VehicleComponent::SnapshotState VehicleComponent::SaveSnapshot() const
+{
+    const PxRigidBody* rigidbody = vehicle_.mPhysXState.physxActor.rigidBody;
+    const GlmTransform pose = PxToGlm(rigidbody->getGlobalPose());
+
+    return SnapshotState{
+        .base_state = vehicle_.mBaseState,
+        .drivetrain_state = vehicle_.mDirectDriveState,
+        .command_state = vehicle_.mCommandState,
+        .transmission_state = vehicle_.mTransmissionCommandState,
+        .position = pose.position,
+        .orientation = pose.orientation,
+        .linear_velocity = PxToGlm(rigidbody->getLinearVelocity()),
+        .angular_velocity = PxToGlm(rigidbody->getAngularVelocity()),
+        .is_grounded = is_grounded_,
+        .respawn_timer = respawn_timer_,
+        .speed_adjuster = speed_adjuster_,
+        .max_velocity = max_velocity_,
+        .time_since_last_particle = time_since_last_particle_,
+        .exhaust_delay = exhaust_delay_};
+}
+
+void VehicleComponent::RestoreSnapshot(const SnapshotState& state)
+{
+    vehicle_.mBaseState = state.base_state;
+    vehicle_.mDirectDriveState = state.drivetrain_state;
+    vehicle_.mCommandState = state.command_state;
+    vehicle_.mTransmissionCommandState = state.transmission_state;
+
+    PxRigidBody* rigidbody = vehicle_.mPhysXState.physxActor.rigidBody;
+    rigidbody->setGlobalPose(
+        CreatePxTransform(state.position, state.orientation));
+    rigidbody->setLinearVelocity(GlmToPx(state.linear_velocity));
+    rigidbody->setAngularVelocity(GlmToPx(state.angular_velocity));
+
+    is_grounded_ = state.is_grounded;
+    respawn_timer_ = state.respawn_timer;
+    speed_adjuster_ = state.speed_adjuster;
+    time_since_last_particle_ = state.time_since_last_particle;
+    exhaust_delay_ = state.exhaust_delay;
+    SetMaxVelocity(state.max_velocity);
+}
+
 void VehicleComponent::UpdateRespawnOrientation(
     const glm::vec3& next_checkpoint, const glm::vec3& last_checkpoint)
 {
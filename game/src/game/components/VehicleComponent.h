@@ -2,31 +2,64 @@
 
 #include <physx/CommonVehicleFiles/directdrivetrain/DirectDrivetrain.h>
 
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <object_ptr.hpp>
 
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdPhysx.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/physics/OnPhysicsUpdateEvent.h"
 #include "engine/physics/VehicleCommands.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "game/FwdGame.h"
 #include "game/components/audio/AudioEmitter.h"
 
 class ParticleSystem;
 
 class VehicleComponent final : public Component,
-                               public IEventSubscriber<OnUpdateEvent>,
                                public IEventSubscriber<OnPhysicsUpdateEvent>
 {
   public:
+    // Everything vehicle2 simulates, plus the PhysX actor it drives
+    struct SnapshotState
+    {
+        snippetvehicle2::BaseVehicleState base_state;
+        snippetvehicle2::DirectDrivetrainState drivetrain_state;
+        physx::vehicle2::PxVehicleCommandState command_state;
+        physx::vehicle2::PxVehicleDirectDriveTransmissionCommandState
+            transmission_state;
+
+        glm::vec3 position;
+        glm::quat orientation;
+        glm::vec3 linear_velocity;
+        glm::vec3 angular_velocity;
+
+        bool is_grounded;
+        float respawn_timer;
+        float speed_adjuster;
+        float max_velocity;
+        float time_since_last_particle;
+        float exhaust_delay;
+    };
+
     /**
      *  resets the vehicle's position to their previously hit checkpoint,
      *  oriented towards the next checkpoint to be hit
      */
     void Respawn();
 
+    /**
+     * Parses the vehicle parameter files into a cache shared by every
+     * vehicle. Safe to call from worker threads, vehicles created afterwards
+     * skip the file IO
+     */
+    static void PreloadParams();
+
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     /* ----- From Component ----- */
 
     void OnInit(const ServiceProvider& service_provider) override;
@@ -36,7 +69,7 @@ class VehicleComponent final : public Component,
 
     /* ----- Event subscribers ----- */
 
-    void OnUpdate(const Timestep& delta_time) override;
+    void OnUpdate(const Timestep& delta_time);
     void OnPhysicsUpdate(const Timestep& step) override;
 
     /* ----- Setters + Getters ----- */
@@ -58,7 +91,7 @@ class VehicleComponent final : public Component,
   private:
     void InitVehicle();
     void InitMaterialFrictionTable();
-    void LoadParams();
+    void LoadParams(bool reload = false);
     void HandleVehicleTransform();
     void UpdateGrounded();
     /// @brief respawns vehicle when not grounded for an amount of time
@@ -42,8 +42,6 @@ void AudioEmitter::OnInit(const ServiceProvider& service_provider)
 
     // component dependencies
     transform_ = &GetEntity().GetComponent<Transform>();
-
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 std::string_view AudioEmitter::GetName() const
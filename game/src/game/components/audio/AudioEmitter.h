@@ -1,12 +1,11 @@
 #pragma once
 
 #include "engine/audio/AudioService.h"
+#include "engine/core/math/Timestep.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "engine/scene/Transform.h"
 
-class AudioEmitter final : public Component,
-                           public IEventSubscriber<OnUpdateEvent>
+class AudioEmitter final : public Component
 {
   public:
     void AddSource(std::string file_name);
@@ -21,9 +20,9 @@ class AudioEmitter final : public Component,
     void OnInit(const ServiceProvider& service_provider) override;
     std::string_view GetName() const override;
 
-    /* ----- from IEventSubscriber ----- */
+    /* ----- from ComponentUpdateService ----- */
 
-    void OnUpdate(const Timestep& delta_time) override;
+    void OnUpdate(const Timestep& delta_time);
 
   private:
     std::string file_name_;
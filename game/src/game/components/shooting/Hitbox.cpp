@@ -23,6 +23,9 @@ void Hitbox::OnInit(const ServiceProvider& service_provider)
 {
     RigidBodyComponent::OnInit(service_provider);
 
+    // The kart's transform drives the hitbox, not the other way around
+    SetTransformSynced(false);
+
     game_state_service_ = &service_provider.GetService<GameStateService>();
 
     vehicle_ = &GetEntity().GetComponent<VehicleComponent>();
@@ -45,7 +48,7 @@ void Hitbox::OnUpdate(const Timestep& delta_time)
     //     }
     // }
 
-    SyncTransform();
+    SyncTransformIfMoved();
 }
 
 string_view Hitbox::GetName() const
@@ -2,9 +2,9 @@
 
 #include <object_ptr.hpp>
 
+#include "engine/core/math/Timestep.h"
 #include "engine/physics/RigidBodyComponent.h"
 #include "engine/scene/Entity.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "engine/scene/Transform.h"
 #include "game/components/VehicleComponent.h"
 #include "game/services/GameStateService.h"
@@ -15,7 +15,8 @@ class Hitbox final : public RigidBodyComponent
     // from RigidBodyComponent
     void OnInit(const ServiceProvider& service_provider) override;
     std::string_view GetName() const override;
-    void OnUpdate(const Timestep& delta_time) override;
+
+    void OnUpdate(const Timestep& delta_time);
 
     // getters + setters
     physx::PxShape* GetShape();
@@ -108,15 +108,14 @@ void Shooter::ShootBuckshot(const vec3& origin, const vec3& fwd_direction)
     }
 
     Entity* target_entity = target_datas[0].value().entity;
+    jss::object_ptr<PlayerState> target_state =
+        target_entity->TryGetComponent<PlayerState>();
 
-    if (!target_entity->HasComponent<PlayerState>())
+    if (!target_state)
     {
         return;
     }
 
-    jss::object_ptr<PlayerState> target_state =
-        &target_entity->GetComponent<PlayerState>();
-
     // TODO: fix this, as the pellets spread, they can hit multiple car, rn we
     // apply the hit to only one car. FIX THIS as this many pellets hit the car.
     target_state->DecrementHealth(GetAmmoDamage() * target_datas.size());
@@ -126,6 +125,26 @@ void Shooter::ShootBuckshot(const vec3& origin, const vec3& fwd_direction)
 }
 
 // The duration between which the 2 consecutive bullets will shoot.
+Shooter::SnapshotState Shooter::SaveSnapshot() const
+{
+    return SnapshotState{
+        .current_ammo_type = current_ammo_type_,
+        .shoot_sound_file = shoot_sound_file_,
+        .increase_fire_speed_multiplier = increase_fire_speed_multiplier_,
+        .laser_lifetime = laser_.lifetime,
+        .timer = timer_};
+}
+
+void Shooter::RestoreSnapshot(const SnapshotState& state)
+{
+    current_ammo_type_ = state.current_ammo_type;
+    shoot_sound_file_ = state.shoot_sound_file;
+    increase_fire_speed_multiplier_ = state.increase_fire_speed_multiplier;
+    laser_.lifetime = state.laser_lifetime;
+    timer_ = state.timer;
+    target_data_.reset();
+}
+
 float Shooter::GetCooldownTime()
 {
     using enum AmmoPickupType;
@@ -157,15 +176,14 @@ void Shooter::UpdateOnHit()
     if (target_data_)
     {
         Entity* target_entity = target_data_.value().entity;
+        jss::object_ptr<PlayerState> target_state =
+            target_entity->TryGetComponent<PlayerState>();
 
-        if (!target_entity->HasComponent<PlayerState>())
+        if (!target_state)
         {
             return;
         }
 
-        jss::object_ptr<PlayerState> target_state =
-            &target_entity->GetComponent<PlayerState>();
-
         target_state->DecrementHealth(GetAmmoDamage());
 
         // vampire bullet increases own players health
@@ -248,8 +266,11 @@ void Shooter::CreateLaser(const vec3& origin, const vec3& target)
     };
 
     // Particle effects
-    spark_particles_->Emit(origin);
-    spark_hit_particles_->Emit(target);
+    if (spark_particles_ && spark_hit_particles_)
+    {
+        spark_particles_->Emit(origin);
+        spark_hit_particles_->Emit(target);
+    }
 }
 
 float RandomPitchValue()
@@ -270,7 +291,7 @@ void Shooter::OnInit(const ServiceProvider& service_provider)
     debug::LogInfo("{} Component - Init", GetName());
 
     // service dependencies
-    render_service_ = &service_provider.GetService<RenderService>();
+    render_service_ = service_provider.TryGetService<RenderService>();
     physics_service_ = &service_provider.GetService<PhysicsService>();
     audio_service_ = &service_provider.GetService<AudioService>();
 
@@ -280,8 +301,12 @@ void Shooter::OnInit(const ServiceProvider& service_provider)
     player_state_ = &GetEntity().GetComponent<PlayerState>();
     audio_emitter_ = &GetEntity().GetComponent<AudioEmitter>();
 
-    spark_particles_ = &render_service_->GetParticleSystem("sparks");
-    spark_hit_particles_ = &render_service_->GetParticleSystem("sparks_hit");
+    if (render_service_)
+    {
+        spark_particles_ = &render_service_->GetParticleSystem("sparks");
+        spark_hit_particles_ =
+            &render_service_->GetParticleSystem("sparks_hit");
+    }
 
     // set initial shoot sound
     shoot_sound_file_ = "kart_shoot_01.ogg";
@@ -289,7 +314,6 @@ void Shooter::OnInit(const ServiceProvider& service_provider)
     audio_emitter_->SetGain(shoot_sound_file_, 0.2f);
 
     hitbox_ = &GetEntity().GetComponent<Hitbox>();
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
 }
 
 std::string_view Shooter::GetName() const
@@ -336,7 +360,10 @@ void Shooter::OnUpdate(const Timestep& delta_time)
         laser_.quad.top_right.alpha = laser_.lifetime / kLaserLifetime;
         laser_.quad.bot_left.alpha = laser_.lifetime / kLaserLifetime;
         laser_.quad.bot_right.alpha = laser_.lifetime / kLaserLifetime;
-        render_service_->GetLaserMaterial().AddQuad(laser_.quad);
+        if (render_service_)
+        {
+            render_service_->AddLaserQuad(laser_.quad);
+        }
 
         laser_.lifetime -= static_cast<float>(delta_time.GetSeconds());
     }
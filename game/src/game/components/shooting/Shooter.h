@@ -1,22 +1,24 @@
 #pragma once
 
 #include <optional>
+#include <string>
+#include <unordered_map>
 
 #include "engine/audio/AudioService.h"
 #include "engine/core/math/Cuboid.h"
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdComponents.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/physics/RaycastData.h"
 #include "engine/render/LaserMaterial.h"
 #include "engine/scene/Component.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "game/components/audio/AudioEmitter.h"
 #include "game/components/shooting/Hitbox.h"
 #include "game/components/state/PlayerState.h"
 
 class ParticleSystem;
 
-class Shooter final : public Component, public IEventSubscriber<OnUpdateEvent>
+class Shooter final : public Component
 {
   public:
     struct Laser
@@ -27,6 +29,18 @@ class Shooter final : public Component, public IEventSubscriber<OnUpdateEvent>
         Quad<LaserVertex> quad;
     };
 
+    struct SnapshotState
+    {
+        AmmoPickupType current_ammo_type;
+        std::string shoot_sound_file;
+        float increase_fire_speed_multiplier;
+        float laser_lifetime;
+        std::unordered_map<AmmoPickupType, double> timer;
+    };
+
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     /**
      *  emits a raycast shot from the entity, updating the entity it hits
      *  (if it hits)
@@ -44,9 +58,9 @@ class Shooter final : public Component, public IEventSubscriber<OnUpdateEvent>
     void OnInit(const ServiceProvider& service_provider) override;
     std::string_view GetName() const override;
 
-    /* ----- from IEventSubscriber ----- */
+    /* ----- from ComponentUpdateService ----- */
 
-    void OnUpdate(const Timestep& delta_time) override;
+    void OnUpdate(const Timestep& delta_time);
 
   private:
     /// hits multiple opponents in some range
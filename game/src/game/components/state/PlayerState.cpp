@@ -23,7 +23,7 @@ void PlayerState::OnInit(const ServiceProvider& service_provider)
     physics_service_ = &service_provider.GetService<PhysicsService>();
     game_state_service_ = &service_provider.GetService<GameStateService>();
     asset_service_ = &service_provider.GetService<AssetService>();
-    render_service_ = &service_provider.GetService<RenderService>();
+    render_service_ = service_provider.TryGetService<RenderService>();
 
     transform_ = &GetEntity().GetComponent<Transform>();
     vehicle_ = &GetEntity().GetComponent<VehicleComponent>();
@@ -33,7 +33,11 @@ void PlayerState::OnInit(const ServiceProvider& service_provider)
     // reset cooldown
     death_cooldown_ = 0.0f;
 
-    explosion_particles_ = &render_service_->GetParticleSystem("explosion");
+    if (render_service_)
+    {
+        explosion_particles_ =
+            &render_service_->GetParticleSystem("explosion");
+    }
 
     // load sounds
     audio_emitter_->AddSource("pickup_get_01.ogg");
@@ -47,7 +51,6 @@ void PlayerState::OnInit(const ServiceProvider& service_provider)
     audio_emitter_->AddSource("wrong_buzz.ogg");
     audio_emitter_->SetGain("wrong_buzz.ogg", 1.0f);
 
-    GetEventBus().Subscribe<OnUpdateEvent>(this);
     player_state_.Reset();
 }
 
@@ -55,6 +58,19 @@ void PlayerState::OnStart()
 {
 }
 
+PlayerState::SnapshotState PlayerState::SaveSnapshot() const
+{
+    return SnapshotState{.player_state = player_state_,
+                         .death_cooldown = death_cooldown_};
+}
+
+void PlayerState::RestoreSnapshot(const SnapshotState& state)
+{
+    // Meshes swapped on death are put back by the MeshRenderer snapshot
+    player_state_ = state.player_state;
+    death_cooldown_ = state.death_cooldown;
+}
+
 void PlayerState::OnUpdate(const Timestep& delta_time)
 {
     CheckDead(delta_time);
@@ -71,58 +87,7 @@ void PlayerState::CheckDead(const Timestep& delta_time)
             auto record =
                 game_state_service_->FindPlayerByEntityId(GetEntity().GetId());
             uint32_t index = record->index;
-            renderer_->SetMeshes({
-                {
-                    &asset_service_->GetMesh("kart@BodyMain"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture(kCarTextures[index]),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@BodyTop"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@BodyTop"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@BodyUnderside"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@BodyTop"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@Muffler"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@BodyTop"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@Wheels"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@Wheels"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                },
-            });
+            SetAliveMeshes(index);
             player_state_.is_dead = false;
             player_state_.health = 100.0f;
             vehicle_->Respawn();
@@ -150,66 +115,141 @@ void PlayerState::CheckDead(const Timestep& delta_time)
             player_state_.number_deaths++;
 
             // set color to deadge color
-            renderer_->SetMeshes({
-                {
-                    &asset_service_->GetMesh("kart@BodyMain"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@Dead"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 128.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@BodyTop"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@Dead"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 128.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@BodyUnderside"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@Dead"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 128.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@Muffler"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@Dead"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 128.0f,
-                    },
-                },
-                {
-                    &asset_service_->GetMesh("kart@Wheels"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("kart@Wheels"),
-                        .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .specular = glm::vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 32.0f,
-                    },
-                },
-            });
-
-            explosion_particles_->Emit(transform_->GetPosition());
+            SetDeadMeshes();
+
+            if (explosion_particles_)
+            {
+                explosion_particles_->Emit(transform_->GetPosition());
+            }
             audio_emitter_->PlaySource("player_die_01.ogg");
             debug::LogDebug("Entity {} has died!", GetEntity().GetId());
         }
     }
 }
 
+void PlayerState::SetAliveMeshes(uint32_t index)
+{
+    // Nothing to swap without a renderer (e.g. headless simulation)
+    if (!render_service_)
+    {
+        return;
+    }
+
+    renderer_->SetMeshes({
+        {
+            &asset_service_->GetMesh("kart@BodyMain"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture(kCarTextures[index]),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 64.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@BodyTop"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@BodyTop"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 64.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@BodyUnderside"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@BodyTop"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 64.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@Muffler"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@BodyTop"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 64.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@Wheels"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@Wheels"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 64.0f,
+            },
+        },
+    });
+}
+
+void PlayerState::SetDeadMeshes()
+{
+    if (!render_service_)
+    {
+        return;
+    }
+
+    renderer_->SetMeshes({
+        {
+            &asset_service_->GetMesh("kart@BodyMain"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@Dead"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 128.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@BodyTop"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@Dead"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 128.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@BodyUnderside"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@Dead"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 128.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@Muffler"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@Dead"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 128.0f,
+            },
+        },
+        {
+            &asset_service_->GetMesh("kart@Wheels"),
+            MaterialProperties{
+                .albedo_texture =
+                    &asset_service_->GetTexture("kart@Wheels"),
+                .albedo_color = glm::vec3(1.0f, 1.0f, 1.0f),
+                .specular = glm::vec3(1.0f, 1.0f, 1.0f),
+                .shininess = 32.0f,
+            },
+        },
+    });
+}
+
 std::string_view PlayerState::GetName() const
 {
     return "PlayerState";
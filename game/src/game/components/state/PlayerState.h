@@ -2,24 +2,34 @@
 #include <memory>
 
 #include "PlayerData.h"
+#include "engine/core/math/Timestep.h"
 #include "engine/fwd/FwdServices.h"
 #include "engine/render/MeshRenderer.h"
 #include "engine/scene/Component.h"
 #include "engine/scene/Entity.h"
-#include "engine/scene/OnUpdateEvent.h"
 #include "game/FwdGame.h"
 #include "game/components/VehicleComponent.h"
 #include "game/components/audio/AudioEmitter.h"
 
-class PlayerState : public Component, public IEventSubscriber<OnUpdateEvent>
+class PlayerState final : public Component
 {
   public:
+    struct SnapshotState
+    {
+        PlayerStateData player_state;
+        float death_cooldown;
+    };
+
+    SnapshotState SaveSnapshot() const;
+    void RestoreSnapshot(const SnapshotState& state);
+
     // From Component
     void OnInit(const ServiceProvider& service_provider) override;
     void OnStart() override;
-    void OnUpdate(const Timestep& delta_time) override;
     std::string_view GetName() const override;
 
+    void OnUpdate(const Timestep& delta_time);
+
     // setters
     void SetMaxCarSpeed(float max_speed);
     void SetHandlingMultiplier(float multiplier);
@@ -61,6 +71,8 @@ class PlayerState : public Component, public IEventSubscriber<OnUpdateEvent>
 
   private:
     void CheckDead(const Timestep& delta_time);
+    void SetAliveMeshes(uint32_t index);
+    void SetDeadMeshes();
 
     PlayerStateData player_state_;
     float death_cooldown_;  /// time until a dead player revives
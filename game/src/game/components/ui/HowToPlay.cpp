@@ -28,7 +28,7 @@ void HowToPlay::OnInit(const ServiceProvider& service_provider)
     next_button_ = &asset_service_->GetTexture("next_button");
 
     // Events
-    GetEventBus().Subscribe<OnGuiEvent>(this);
+    ManageEventSub(GetEventBus().Subscribe<OnGuiEvent>(this));
 }
 
 string_view HowToPlay::GetName() const
@@ -0,0 +1,57 @@
+#include "game/components/ui/LoadingScreen.h"
+
+#include <string>
+
+#include "engine/gui/GuiService.h"
+
+using std::string;
+using std::string_view;
+
+static constexpr size_t kMaxDots = 3;
+static constexpr double kSecondsPerDot = 0.3;
+
+void LoadingScreen::OnInit(const ServiceProvider& service_provider)
+{
+    // Dependencies
+    gui_service_ = &service_provider.GetService<GuiService>();
+
+    font_ = gui_service_->GetFont("impact");
+
+    // Events
+    ManageEventSub(GetEventBus().Subscribe<OnGuiEvent>(this));
+}
+
+string_view LoadingScreen::GetName() const
+{
+    return "LoadingScreen";
+}
+
+void LoadingScreen::OnGui()
+{
+    ImGuiWindowFlags flags =
+        ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoDecoration |
+        ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoSavedSettings;
+
+    const ImVec2& screen_size = ImGui::GetIO().DisplaySize;
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(screen_size);
+    ImGui::SetNextWindowBgAlpha(1.0f);
+
+    ImGui::Begin("LoadingScreen", nullptr, flags);
+    ImGui::PushFont(font_);
+
+    // Dots keep moving, so it's obvious the game hasn't frozen
+    const size_t dots =
+        static_cast<size_t>(ImGui::GetTime() / kSecondsPerDot) % (kMaxDots + 1);
+    const string text = "Loading" + string(dots, '.');
+
+    // Centered on the full width of the text, so it doesn't shift around
+    const ImVec2 text_size = ImGui::CalcTextSize("Loading...");
+    ImGui::SetCursorPos(ImVec2((screen_size.x - text_size.x) * 0.5f,
+                               (screen_size.y - text_size.y) * 0.5f));
+    ImGui::TextUnformatted(text.c_str());
+
+    ImGui::PopFont();
+    ImGui::End();
+}
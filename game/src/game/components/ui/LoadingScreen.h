@@ -0,0 +1,29 @@
+#pragma once
+
+#include <imgui.h>
+
+#include <object_ptr.hpp>
+
+#include "engine/fwd/FwdServices.h"
+#include "engine/gui/OnGuiEvent.h"
+#include "engine/scene/Component.h"
+
+class GuiService;
+
+// Shown while the next scene is being prepared, so it must stay cheap
+class LoadingScreen final : public Component,
+                            public IEventSubscriber<OnGuiEvent>
+{
+  public:
+    // From Component
+    void OnInit(const ServiceProvider& service_provider) override;
+    std::string_view GetName() const override;
+
+    // From IEventSubscriber<OnGuiEvent>
+    void OnGui() override;
+
+  private:
+    jss::object_ptr<GuiService> gui_service_;
+
+    ImFont* font_;
+};
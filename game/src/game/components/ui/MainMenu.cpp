@@ -34,7 +34,7 @@ void MainMenu::OnInit(const ServiceProvider& service_provider)
     setting_button_ = &asset_service_->GetTexture("settings_button");
 
     // Events
-    GetEventBus().Subscribe<OnGuiEvent>(this);
+    ManageEventSub(GetEventBus().Subscribe<OnGuiEvent>(this));
 }
 
 string_view MainMenu::GetName() const
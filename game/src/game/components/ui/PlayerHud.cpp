@@ -27,7 +27,7 @@ void PlayerHud::OnInit(const ServiceProvider& service_provider)
     transform_ = &GetEntity().GetComponent<Transform>();
 
     // Events
-    GetEventBus().Subscribe<OnGuiEvent>(this);
+    ManageEventSub(GetEventBus().Subscribe<OnGuiEvent>(this));
 
     // Assets
     disableHandling_ = &asset_service_->GetTexture("disable");
@@ -28,7 +28,7 @@ void Powerups::OnInit(const ServiceProvider& service_provider)
     home_button_ = &asset_service_->GetTexture("home_button");
 
     // Events
-    GetEventBus().Subscribe<OnGuiEvent>(this);
+    ManageEventSub(GetEventBus().Subscribe<OnGuiEvent>(this));
 }
 
 string_view Powerups::GetName() const
@@ -35,7 +35,7 @@ void Setting::OnInit(const ServiceProvider& service_provider)
     music_enabled = true;
 
     // Events
-    GetEventBus().Subscribe<OnGuiEvent>(this);
+    ManageEventSub(GetEventBus().Subscribe<OnGuiEvent>(this));
 }
 
 string_view Setting::GetName() const
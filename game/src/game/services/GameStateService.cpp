@@ -16,11 +16,13 @@
 #include "engine/physics/BoxTrigger.h"
 #include "engine/physics/PhysicsService.h"
 #include "engine/pickup/PickupService.h"
+#include "engine/prefab/PrefabService.h"
 #include "engine/render/Camera.h"
 #include "engine/render/MeshRenderer.h"
 #include "engine/render/ParticleSystem.h"
 #include "engine/scene/OnUpdateEvent.h"
 #include "engine/scene/SceneDebugService.h"
+#include "engine/scene/SceneSnapshotService.h"
 #include "game/Checkpoints.h"
 #include "game/components/Controllers/AIController.h"
 #include "game/components/Controllers/PlayerController.h"
@@ -71,6 +73,22 @@ static const array<string, 6> kAmmos = {
     "kDefaultAmmo",      "kBuckshot",         "kDoubleDamage",
     "kExploadingBullet", "kIncreaseFireRate", "kVampireBullet"};
 
+// Prefabs indexed like kPowerups and kAmmos, default types don't spawn
+static const array<const char*, 5> kPowerupPrefabs = {
+    nullptr, "pickup-disable-handling", "pickup-everyone-slower",
+    "pickup-increase-aim-box", "pickup-kill-abilities"};
+static const array<const char*, 6> kAmmoPrefabs = {
+    nullptr,
+    "pickup-buckshot",
+    "pickup-double-damage",
+    "pickup-exploading-bullet",
+    "pickup-increase-fire-rate",
+    "pickup-vampire-bullet"};
+
+static constexpr const char* kHumanKartPrefab = "kart-human";
+static constexpr const char* kAiKartPrefab = "kart-ai";
+static constexpr const char* kCheckpointPrefab = "checkpoint";
+
 void GlobalRaceState::Reset()
 {
     state = GameState::kNotRunning;
@@ -90,6 +108,13 @@ void GameStateService::OnInit()
     race_config_.num_ai_players = 3;
     race_config_.num_laps = 1;
 
+    // Nobody is around to drive when running headless, fill the grid with AI
+    if (GetApp().IsHeadless())
+    {
+        race_config_.num_human_players = 0;
+        race_config_.num_ai_players = kMaxPlayers;
+    }
+
     race_state_.Reset();
 
     // Get where the powerups should be spawned and what type.
@@ -101,16 +126,23 @@ void GameStateService::OnStart(ServiceProvider& service_provider)
     // Services
     audio_service_ = &service_provider.GetService<AudioService>();
     asset_service_ = &service_provider.GetService<AssetService>();
-    gui_service_ = &service_provider.GetService<GuiService>();
-    scene_service_ = &service_provider.GetService<SceneDebugService>();
+    gui_service_ = service_provider.TryGetService<GuiService>();
+    scene_service_ = service_provider.TryGetService<SceneDebugService>();
     input_service_ = &service_provider.GetService<InputService>();
     physics_service_ = &service_provider.GetService<PhysicsService>();
     pickup_service_ = &service_provider.GetService<PickupService>();
+    prefab_service_ = &service_provider.GetService<PrefabService>();
+    snapshot_service_ = &service_provider.GetService<SceneSnapshotService>();
 
     // Events
     GetEventBus().Subscribe<OnGuiEvent>(this);
 
-    // Assets
+    // UI assets, none of which exist without a window
+    if (GetApp().IsHeadless())
+    {
+        return;
+    }
+
     font_beya_ = gui_service_->GetFont("beya");
     font_pado_ = gui_service_->GetFont("pado");
     font_impact_ = gui_service_->GetFont("impact");
@@ -133,9 +165,9 @@ void GameStateService::OnStart(ServiceProvider& service_provider)
     minimap_ = &asset_service_->GetTexture("minimap");
 }
 
-void GameStateService::OnUpdate()
+void GameStateService::OnUpdate(const FrameContext& frame)
 {
-    const Timestep& delta_time = GetApp().GetDeltaTime();
+    const Timestep& delta_time = frame.delta_time;
 
     if (input_service_->IsKeyPressed(GLFW_KEY_F6))
     {
@@ -623,6 +655,18 @@ void GameStateService::DrawDebugMenu()
     ImGui::End();
 }
 
+void GameStateService::OnScenePrepare(const std::string& scene_name)
+{
+    if (scene_name != "Track1")
+    {
+        return;
+    }
+
+    // Everything SetupRace would otherwise read from disk
+    Checkpoints::PrepareCheckpointFile();
+    VehicleComponent::PreloadParams();
+}
+
 void GameStateService::OnSceneLoaded(Scene& scene)
 {
     race_state_.Reset();
@@ -648,9 +692,34 @@ void GameStateService::OnSceneLoaded(Scene& scene)
 
         SetupRace();
         StartCountdown();
+
+        // Restarts go back to this point instead of reloading the track
+        snapshot_service_->RequestCapture();
     }
 }
 
+void GameStateService::OnSceneRestored(Scene& scene)
+{
+    race_state_.Reset();
+
+    for (auto& player : players_)
+    {
+        player->checkpoint_count_accumulator = 0;
+        player->progress_score = 0.0f;
+        player->finished_time = 0.0;
+    }
+
+    player_details_.clear();
+    players_respawn_.clear();
+    timer_.clear();
+    timestamp_map.clear();
+    kill_feed_info_.clear();
+    most_kills = {"", -1};
+    least_deaths = {"", 1000};
+
+    StartCountdown();
+}
+
 void GameStateService::OnCleanup()
 {
 }
@@ -660,6 +729,18 @@ std::string_view GameStateService::GetName() const
     return "Game State Service";
 }
 
+ServiceAccess GameStateService::GetAccess() const
+{
+    // Ranks the players through their components, and hands finished ones
+    // over to an AIController
+    return ServiceAccess{
+        .reads = service_access::kInput | service_access::kScene |
+                 service_access::kPhysics | service_access::kGameState,
+        .writes = service_access::kScene | service_access::kGameState,
+        .main_thread = true,
+        .phase = UpdatePhase::kSimulation};
+}
+
 void GameStateService::StartCountdown()
 {
     race_state_.state = GameState::kCountdown;
@@ -702,233 +783,35 @@ void GameStateService::SetupRace()
 void GameStateService::SetupPowerups()
 {
     Scene& scene = GetApp().GetSceneList().GetActiveScene();
-    for (int i = 0, j = 0; i < powerup_info.size(), j < ammo_info_.size();
-         i++, j++)
-    {
-    }
+
     for (const auto& powerup : powerup_info)
     {
-        int powerup_to_int = 0;
-        switch (powerup.first)
-        {
-            case PowerupPickupType::kDefaultPowerup:
-                powerup_to_int = 0;
-                break;
-
-            case PowerupPickupType::kDisableHandling:
-                powerup_to_int = 1;
-                break;
-
-            case PowerupPickupType::kEveryoneSlower:
-                powerup_to_int = 2;
-                break;
-
-            case PowerupPickupType::kIncreaseAimBox:
-                powerup_to_int = 3;
-                break;
-
-            case PowerupPickupType::kKillAbilities:
-                powerup_to_int = 4;
-                break;
-        }
-        // make entities for powerups here.
-        string entity_name = kPowerups[powerup_to_int] + "  " +
-                             std::to_string(powerup.second.x) + ", " +
-                             std::to_string(powerup.second.y) + ", " +
-                             std::to_string(powerup.second.z);
-
-        Entity& entity = scene.AddEntity(entity_name);
-
-        auto& transform = entity.AddComponent<Transform>();
-        transform.SetPosition(powerup.second);
-
-        auto& mesh_renderer = entity.AddComponent<MeshRenderer>();
-
-        switch (powerup.first)
-        {
-            case PowerupPickupType::kDisableHandling:
-                entity.AddComponent<DisableHandlingPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("handling"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@powerup"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                break;
-
-            case PowerupPickupType::kEveryoneSlower:
-                entity.AddComponent<EveryoneSlowerPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("slow"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@powerup"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                break;
-
-            case PowerupPickupType::kIncreaseAimBox:
-                entity.AddComponent<IncreaseAimBoxPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("aimBox"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@powerup"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                transform.SetScale(vec3(3.f, 3.f, 3.f));
-                break;
-
-            case PowerupPickupType::kKillAbilities:
-                entity.AddComponent<KillAbilitiesPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("killAbility"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@powerup"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                break;
-        }
-
-        auto& trigger = entity.AddComponent<BoxTrigger>();
-        trigger.SetSize(vec3(2.0f, 10.0f, 2.0f));
+        const size_t type = static_cast<size_t>(powerup.first);
+        SpawnPickup(scene, kPowerups[type], kPowerupPrefabs[type],
+                    powerup.second);
     }
 
-    for (const auto& powerup : ammo_info_)
+    for (const auto& ammo : ammo_info_)
     {
-        int powerup_to_int = 0;
-        switch (powerup.first)
-        {
-            case AmmoPickupType::kDefaultAmmo:
-                powerup_to_int = 0;
-                break;
-
-            case AmmoPickupType::kBuckshot:
-                powerup_to_int = 1;
-                break;
-
-            case AmmoPickupType::kDoubleDamage:
-                powerup_to_int = 2;
-                break;
-
-            case AmmoPickupType::kExploadingBullet:
-                powerup_to_int = 3;
-                break;
-
-            case AmmoPickupType::kIncreaseFireRate:
-                powerup_to_int = 4;
-                break;
-
-            case AmmoPickupType::kVampireBullet:
-                powerup_to_int = 5;
-                break;
-        }
-        // make entities for powerups here.
-        string entity_name = kAmmos[powerup_to_int] + "  " +
-                             std::to_string(powerup.second.x) + ", " +
-                             std::to_string(powerup.second.y) + ", " +
-                             std::to_string(powerup.second.z);
-
-        Entity& entity = scene.AddEntity(entity_name);
-
-        auto& transform = entity.AddComponent<Transform>();
-        transform.SetPosition(powerup.second);
+        const size_t type = static_cast<size_t>(ammo.first);
+        SpawnPickup(scene, kAmmos[type], kAmmoPrefabs[type], ammo.second);
+    }
+}
 
-        auto& mesh_renderer = entity.AddComponent<MeshRenderer>();
+void GameStateService::SpawnPickup(Scene& scene, const string& type_name,
+                                   const char* prefab, const vec3& position)
+{
+    if (!prefab)
+    {
+        return;
+    }
 
-        switch (powerup.first)
-        {
-            case AmmoPickupType::kBuckshot:
-                entity.AddComponent<BuckshotPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("buckshot"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@bullets"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                transform.SetScale(vec3(0.2f, 0.2f, 0.2f));
-                break;
-
-            case AmmoPickupType::kDoubleDamage:
-                entity.AddComponent<DoubleDamagePickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("damage"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@bullets"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                break;
-
-            case AmmoPickupType::kExploadingBullet:
-                entity.AddComponent<ExploadingBulletPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("exploding"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@bullets"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                transform.SetScale(vec3(3.f, 3.f, 3.f));
-                break;
-
-            case AmmoPickupType::kIncreaseFireRate:
-                entity.AddComponent<IncreaseFireRatePickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("increase"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@bullets"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                break;
-
-            case AmmoPickupType::kVampireBullet:
-                entity.AddComponent<VampireBulletPickup>();
-                mesh_renderer.SetMesh({
-                    &asset_service_->GetMesh("vampire"),
-                    MaterialProperties{
-                        .albedo_texture =
-                            &asset_service_->GetTexture("pickup@bullets"),
-                        .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                        .specular = vec3(1.0f, 1.0f, 1.0f),
-                        .shininess = 64.0f,
-                    },
-                });
-                transform.SetScale(vec3(0.2f, 0.2f, 0.2f));
-                break;
-        }
+    const string entity_name =
+        type_name + "  " + std::to_string(position.x) + ", " +
+        std::to_string(position.y) + ", " + std::to_string(position.z);
 
-        auto& trigger = entity.AddComponent<BoxTrigger>();
-        trigger.SetSize(vec3(4.0f, 10.0f, 4.0f));
-    }
+    prefab_service_->Instantiate(
+        scene, prefab, PrefabSpawn{.name = entity_name, .position = position});
 }
 
 void GameStateService::StartRace()
@@ -982,9 +865,30 @@ void GameStateService::PlayerCompletedLap(PlayerRecord& player)
         }
 
         race_state_.finished_players++;
+
+        if (GetApp().IsHeadless() &&
+            race_state_.finished_players == players_.size())
+        {
+            FinishHeadlessRace();
+        }
     }
 }
 
+void GameStateService::FinishHeadlessRace()
+{
+    debug::LogInfo("Headless race finished in {:.2f}s",
+                   race_state_.elapsed_time.GetSeconds());
+
+    for (auto& player : players_)
+    {
+        debug::LogInfo("  {}: {:.2f}s", player->entity->GetName(),
+                       player->finished_time);
+    }
+
+    // Reset the track so the simulation keeps running races back to back
+    snapshot_service_->RequestRestore();
+}
+
 void GameStateService::RegisterCheckpoint(Entity& entity,
                                           Checkpoint* checkpoint)
 {
@@ -1127,16 +1031,21 @@ void GameStateService::LoadCheckpoints(Scene& scene)
 
         for (int i = 0; i < checkpoints.size(); i++)
         {
-            Entity& entity = scene.AddEntity("Checkpoint " + std::to_string(i));
-            auto& transform = entity.AddComponent<Transform>();
-            transform.SetPosition(checkpoints[i].position);
+            const PrefabSpawn spawn{.name = "Checkpoint " + std::to_string(i),
+                                    .position = checkpoints[i].position};
+            Entity& entity =
+                prefab_service_->Instantiate(scene, kCheckpointPrefab, spawn);
+
+            // Checkpoint orientations are in radians, unlike a PrefabSpawn
+            auto& transform = entity.GetComponent<Transform>();
             transform.SetOrientation(glm::quat(checkpoints[i].orientation));
             transform.SetScale(checkpoints[i].size);
 
-            auto& trigger = entity.AddComponent<BoxTrigger>();
+            auto& trigger = entity.GetComponent<BoxTrigger>();
             trigger.SetSize(checkpoints[i].size);
+            trigger.SyncTransform();
 
-            auto& checkpoint = entity.AddComponent<Checkpoint>();
+            auto& checkpoint = entity.GetComponent<Checkpoint>();
             checkpoint.SetCheckpointIndex(i);
         }
     }
@@ -1265,95 +1174,19 @@ Entity& GameStateService::CreatePlayer(uint32_t index, bool is_human)
     const std::string& entity_name =
         is_human ? kHumanPlayerNames[index] : kAiPlayerNames[index];
 
-    // Create & configure car entity
-    Entity& kart_entity = scene.AddEntity(entity_name);
+    // Humans also get a camera following their kart
+    Entity& kart_entity = prefab_service_->Instantiate(
+        scene, is_human ? kHumanKartPrefab : kAiKartPrefab,
+        PrefabSpawn{
+            .name = entity_name,
+            .position = config.position,
+            .orientation_euler_degrees = config.orientation_euler_degrees,
+        });
 
-    auto& transform = kart_entity.AddComponent<Transform>();
-    transform.SetPosition(config.position);
-    transform.RotateEulerDegrees(config.orientation_euler_degrees);
+    SetKartTexture(kart_entity.GetComponent<MeshRenderer>(), index);
 
-    auto& renderer = kart_entity.AddComponent<MeshRenderer>();
-    renderer.SetMeshes({
-        {
-            &asset_service_->GetMesh("kart@BodyMain"),
-            MaterialProperties{
-                .albedo_texture =
-                    &asset_service_->GetTexture(kCarTextures[index]),
-                .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                .specular = vec3(1.0f, 1.0f, 1.0f),
-                .shininess = 64.0f,
-            },
-        },
-        {
-            &asset_service_->GetMesh("kart@BodyTop"),
-            MaterialProperties{
-                .albedo_texture = &asset_service_->GetTexture("kart@BodyTop"),
-                .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                .specular = vec3(1.0f, 1.0f, 1.0f),
-                .shininess = 64.0f,
-            },
-        },
-        {
-            &asset_service_->GetMesh("kart@BodyUnderside"),
-            MaterialProperties{
-                .albedo_texture =
-                    &asset_service_->GetTexture("kart@BodyUnderside"),
-                .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                .specular = vec3(1.0f, 1.0f, 1.0f),
-                .shininess = 64.0f,
-            },
-        },
-        {
-            &asset_service_->GetMesh("kart@Muffler"),
-            MaterialProperties{
-                .albedo_texture = &asset_service_->GetTexture("kart@Muffler"),
-                .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                .specular = vec3(1.0f, 1.0f, 1.0f),
-                .shininess = 64.0f,
-            },
-        },
-        {
-            &asset_service_->GetMesh("kart@Wheels"),
-            MaterialProperties{
-                .albedo_texture = &asset_service_->GetTexture("kart@Wheels"),
-                .albedo_color = vec3(1.0f, 1.0f, 1.0f),
-                .specular = vec3(1.0f, 1.0f, 1.0f),
-                .shininess = 64.0f,
-            },
-        },
-    });
-
-    kart_entity.AddComponent<AudioEmitter>();
-
-    auto& vehicle = kart_entity.AddComponent<VehicleComponent>();
-    auto& player_state = kart_entity.AddComponent<PlayerState>();
-    vehicle.SetVehicleName(entity_name);
-
-    auto& hitbox_component = kart_entity.AddComponent<Hitbox>();
-    hitbox_component.SetSize(vec3(15.0f, 10.0f, 15.0f));
-
-    kart_entity.AddComponent<Shooter>();
-
-    if (is_human)
-    {
-        auto& audio_listener = kart_entity.AddComponent<AudioListener>();
-
-        kart_entity.AddComponent<PlayerController>();
-        kart_entity.AddComponent<PlayerHud>();
-
-        // Also create camera
-        Entity& camera_entity = scene.AddEntity("PlayerCamera");
-        camera_entity.AddComponent<Transform>();
-        camera_entity.AddComponent<Camera>();
-
-        auto& camera_follower = camera_entity.AddComponent<FollowCamera>();
-        camera_follower.SetFollowingTransform(kart_entity);
-        camera_follower.SetPlayerState(player_state);
-    }
-    else
-    {
-        auto& ai_controller = kart_entity.AddComponent<AIController>();
-    }
+    auto& transform = kart_entity.GetComponent<Transform>();
+    auto& player_state = kart_entity.GetComponent<PlayerState>();
 
     // Register the player
     players_.push_back(make_unique<PlayerRecord>(
@@ -1368,6 +1201,21 @@ Entity& GameStateService::CreatePlayer(uint32_t index, bool is_human)
     return kart_entity;
 }
 
+void GameStateService::SetKartTexture(MeshRenderer& renderer, uint32_t index)
+{
+    // Textures aren't loaded when headless, so the kart has no meshes
+    if (GetApp().IsHeadless())
+    {
+        return;
+    }
+
+    // The prefab's first mesh is the body, which is coloured per player
+    std::vector<RenderableMesh> meshes = renderer.GetMeshes();
+    meshes.front().material_properties.albedo_texture =
+        &asset_service_->GetTexture(kCarTextures[index]);
+    renderer.SetMeshes(meshes);
+}
+
 CheckpointRecord& GameStateService::GetNextCheckpoint(uint32_t current_index)
 {
     size_t next_index = static_cast<size_t>(current_index) + 1;
@@ -24,6 +24,7 @@
 #include "game/services/RaceConfig.h"
 
 class Checkpoint;
+class MeshRenderer;
 class PlayerState;
 class Transform;
 class Texture;
@@ -73,11 +74,14 @@ class GameStateService : public Service, public IEventSubscriber<OnGuiEvent>
 
     // From Service
     void OnInit() override;
-    void OnUpdate() override;
+    void OnUpdate(const FrameContext& frame) override;
     void OnCleanup() override;
     void OnStart(ServiceProvider& service_provider);
+    void OnScenePrepare(const std::string& scene_name) override;
     void OnSceneLoaded(Scene& scene) override;
+    void OnSceneRestored(Scene& scene) override;
     std::string_view GetName() const override;
+    ServiceAccess GetAccess() const override;
 
     // From Event subscribers
     void OnGui() override;
@@ -133,6 +137,8 @@ class GameStateService : public Service, public IEventSubscriber<OnGuiEvent>
     jss::object_ptr<InputService> input_service_;
     jss::object_ptr<PhysicsService> physics_service_;
     jss::object_ptr<PickupService> pickup_service_;
+    jss::object_ptr<PrefabService> prefab_service_;
+    jss::object_ptr<SceneSnapshotService> snapshot_service_;
 
     std::vector<std::unique_ptr<PlayerRecord>> players_;
 
@@ -172,7 +178,11 @@ class GameStateService : public Service, public IEventSubscriber<OnGuiEvent>
     void SetupPowerups();
     void LoadCheckpoints(Scene& scene);
     void PlayerCompletedLap(PlayerRecord& player);
+    void FinishHeadlessRace();
     Entity& CreatePlayer(uint32_t index, bool is_human);
+    void SetKartTexture(MeshRenderer& renderer, uint32_t index);
+    void SpawnPickup(Scene& scene, const std::string& type_name,
+                     const char* prefab, const glm::vec3& position);
     CheckpointRecord& GetNextCheckpoint(uint32_t current_index);
     void StartCountdown();
     void DisplayScoreboard();
@@ -9,10 +9,14 @@
 
 #include <PxPhysicsAPI.h>
 
+#include <charconv>
+#include <cstdlib>
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "engine/core/debug/Assert.h"
 #include "engine/core/debug/Log.h"
@@ -20,22 +24,115 @@
 #include "game/GameApp.h"
 
 using std::make_shared;
+using std::string;
+using std::string_view;
 
-int main()
+static void printUsage()
 {
-    initGFLW();
+    std::cerr << "Usage: game [--headless] [--no-sim-thread] "
+                 "[--frames <count>] [--max-fps <fps>]\n";
+}
+
+// The whole string has to be a number, so "12abc" is rejected too
+template <class T>
+static std::optional<T> parseNumber(string_view value)
+{
+    T result{};
+    const char* end = value.data() + value.size();
+    const auto [ptr, error] = std::from_chars(value.data(), end, result);
+
+    if (error != std::errc() || ptr != end)
+    {
+        return std::nullopt;
+    }
+
+    return result;
+}
+
+// Exits with the usage if the flag has no value, or it isn't a number
+template <class T>
+static T parseNumberArg(int argc, char* argv[], int& i)
+{
+    const string_view flag = argv[i];
+
+    if (i + 1 >= argc)
+    {
+        debug::LogError("Missing value for argument: {}", flag);
+        printUsage();
+        std::exit(EXIT_FAILURE);
+    }
+
+    const string_view value = argv[++i];
+    const std::optional<T> number = parseNumber<T>(value);
+
+    if (!number)
+    {
+        debug::LogError("Invalid value for argument {}: {}", flag, value);
+        printUsage();
+        std::exit(EXIT_FAILURE);
+    }
+
+    return number.value();
+}
+
+int main(int argc, char* argv[])
+{
+    const AppOptions options = parseArgs(argc, argv);
+
+    if (!options.headless)
+    {
+        initGFLW();
+    }
 
     // Create and start app
     debug::LogDebug("Starting app");
-    std::shared_ptr game = make_shared<GameApp>();
+    std::shared_ptr game = make_shared<GameApp>(options);
     game->Run();
 
     // GLFW cleanup
     debug::LogDebug("Cleaning up");
-    glfwTerminate();
+
+    if (!options.headless)
+    {
+        glfwTerminate();
+    }
+
     return 0;
 }
 
+AppOptions parseArgs(int argc, char* argv[])
+{
+    AppOptions options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string arg = argv[i];
+
+        if (arg == "--headless")
+        {
+            options.headless = true;
+        }
+        else if (arg == "--no-sim-thread")
+        {
+            options.threaded_simulation = false;
+        }
+        else if (arg == "--frames")
+        {
+            options.max_frames = parseNumberArg<uint64_t>(argc, argv, i);
+        }
+        else if (arg == "--max-fps")
+        {
+            options.max_fps = parseNumberArg<double>(argc, argv, i);
+        }
+        else
+        {
+            debug::LogWarn("Ignoring unknown argument: {}", arg);
+        }
+    }
+
+    return options;
+}
+
 void initGFLW()
 {
     // GFLW init
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "engine/App.h"
+
 void initPhysX();
 
 void initGFLW();
+
+AppOptions parseArgs(int argc, char* argv[]);
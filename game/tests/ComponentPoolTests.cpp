@@ -0,0 +1,119 @@
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+#include "Test.h"
+#include "engine/scene/ComponentPool.h"
+
+struct PoolComponent final : public Component
+{
+    int value = 0;
+
+    void OnInit(const ServiceProvider& service_provider) override
+    {
+    }
+
+    std::string_view GetName() const override
+    {
+        return "PoolComponent";
+    }
+};
+
+using Pool = ComponentPool<PoolComponent>;
+
+TEST_CASE(ComponentPoolGrowsAcrossBlocks)
+{
+    std::pmr::unsynchronized_pool_resource memory;
+    Pool pool(memory);
+
+    const size_t count = Pool::kBlockSize * 2 + 3;
+    std::set<PoolComponent*> addresses;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        PoolComponent& component = pool.Create();
+        component.value = static_cast<int>(i);
+        addresses.insert(&component);
+    }
+
+    CHECK_EQ(pool.GetSize(), count);
+    CHECK_EQ(addresses.size(), count);
+
+    // Adding blocks must not move or overwrite the components already there
+    size_t visited = 0;
+    int sum = 0;
+
+    pool.ForEachComponent(
+        [&](PoolComponent& component)
+        {
+            CHECK(addresses.contains(&component));
+            sum += component.value;
+            visited++;
+        });
+
+    CHECK_EQ(visited, count);
+    CHECK_EQ(sum, static_cast<int>(count * (count - 1) / 2));
+}
+
+TEST_CASE(ComponentPoolReusesFreedSlots)
+{
+    std::pmr::unsynchronized_pool_resource memory;
+    Pool pool(memory);
+
+    std::vector<PoolComponent*> components;
+
+    for (size_t i = 0; i < Pool::kBlockSize + 1; i++)
+    {
+        components.push_back(&pool.Create());
+    }
+
+    PoolComponent* freed = components[3];
+    pool.Destroy(*freed);
+    CHECK_EQ(pool.GetSize(), components.size() - 1);
+
+    // The freed slot comes back before a new one is used
+    PoolComponent& reused = pool.Create();
+    CHECK_EQ(&reused, freed);
+    CHECK_EQ(reused.value, 0);
+    CHECK_EQ(pool.GetSize(), components.size());
+}
+
+TEST_CASE(ComponentPoolSkipsDestroyedComponents)
+{
+    std::pmr::unsynchronized_pool_resource memory;
+    Pool pool(memory);
+
+    std::vector<PoolComponent*> components;
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        components.push_back(&pool.Create());
+    }
+
+    pool.Destroy(*components[0]);
+    pool.Destroy(*components[5]);
+    pool.Destroy(*components[9]);
+
+    size_t visited = 0;
+
+    pool.ForEachComponent(
+        [&](PoolComponent& component)
+        {
+            CHECK(&component != components[0]);
+            CHECK(&component != components[5]);
+            CHECK(&component != components[9]);
+            visited++;
+        });
+
+    CHECK_EQ(visited, size_t(7));
+    CHECK_EQ(pool.GetSize(), size_t(7));
+    CHECK(pool.GetAny() != nullptr);
+
+    for (size_t i : {1, 2, 3, 4, 6, 7, 8})
+    {
+        pool.Destroy(*components[i]);
+    }
+
+    CHECK_EQ(pool.GetSize(), size_t(0));
+    CHECK(pool.GetAny() == nullptr);
+}
@@ -0,0 +1,174 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "engine/core/event/ConcurrentEventQueue.h"
+
+struct QueuedEvent : public IEvent
+{
+    uint32_t producer;
+    uint32_t sequence;
+};
+
+template <>
+class IEventSubscriber<QueuedEvent>
+{
+  public:
+    virtual void OnQueuedEvent(const QueuedEvent& event) = 0;
+};
+
+template <>
+inline void EventDispatcher::Dispatch<QueuedEvent>(
+    IEventSubscriber<QueuedEvent>* subscriber, const QueuedEvent* event)
+{
+    subscriber->OnQueuedEvent(*event);
+}
+
+struct QueueSubscriber : public IEventSubscriber<QueuedEvent>
+{
+    std::vector<QueuedEvent> received;
+
+    void OnQueuedEvent(const QueuedEvent& event) override
+    {
+        received.push_back(event);
+    }
+};
+
+TEST_CASE(ConcurrentEventQueueRoundsCapacity)
+{
+    CHECK_EQ(ConcurrentEventQueue<QueuedEvent>(0).GetCapacity(), size_t(2));
+    CHECK_EQ(ConcurrentEventQueue<QueuedEvent>(5).GetCapacity(), size_t(8));
+    CHECK_EQ(ConcurrentEventQueue<QueuedEvent>(64).GetCapacity(), size_t(64));
+}
+
+TEST_CASE(ConcurrentEventQueueCountsOverflow)
+{
+    ConcurrentEventQueue<QueuedEvent> queue(4);
+    EventBus bus;
+    QueueSubscriber subscriber;
+    bus.AddSource(&queue);
+    bus.Subscribe<QueuedEvent>(&subscriber);
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        CHECK(queue.Push(QueuedEvent{.producer = 0, .sequence = i}));
+    }
+
+    // Full, so these are dropped instead of overwriting the oldest
+    CHECK(!queue.Push(QueuedEvent{.producer = 0, .sequence = 4}));
+    CHECK(!queue.Push(QueuedEvent{.producer = 0, .sequence = 5}));
+    CHECK_EQ(queue.GetOverflowCount(), uint64_t(2));
+    CHECK_EQ(queue.GetDepth(), size_t(4));
+
+    bus.Flush();
+    CHECK_EQ(subscriber.received.size(), size_t(4));
+    CHECK_EQ(subscriber.received.back().sequence, uint32_t(3));
+    CHECK_EQ(queue.GetDepth(), size_t(0));
+    CHECK_EQ(queue.GetPeakBatchSize(), size_t(4));
+
+    // Room again once delivered
+    CHECK(queue.Push(QueuedEvent{.producer = 0, .sequence = 6}));
+    bus.RemoveSource(&queue);
+}
+
+TEST_CASE(ConcurrentEventQueueWrapsAround)
+{
+    ConcurrentEventQueue<QueuedEvent> queue(8);
+    EventBus bus;
+    QueueSubscriber subscriber;
+    bus.AddSource(&queue);
+    bus.Subscribe<QueuedEvent>(&subscriber);
+
+    // Uneven batches, so the head and tail land on every cell over the laps
+    uint32_t pushed = 0;
+
+    for (uint32_t lap = 0; lap < 100; lap++)
+    {
+        const uint32_t batch = 1 + (lap * 3) % 8;
+
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            CHECK(queue.Push(QueuedEvent{.producer = 0, .sequence = pushed}));
+            pushed++;
+        }
+
+        bus.Flush();
+    }
+
+    CHECK_EQ(subscriber.received.size(), size_t(pushed));
+    CHECK_EQ(queue.GetOverflowCount(), uint64_t(0));
+
+    for (uint32_t i = 0; i < subscriber.received.size(); i++)
+    {
+        CHECK_EQ(subscriber.received[i].sequence, i);
+    }
+
+    // Cleared events are never delivered
+    queue.Push(QueuedEvent{.producer = 0, .sequence = pushed});
+    queue.Clear();
+    bus.Flush();
+    CHECK_EQ(subscriber.received.size(), size_t(pushed));
+    bus.RemoveSource(&queue);
+}
+
+TEST_CASE(ConcurrentEventQueueKeepsEveryProducersEvents)
+{
+    static constexpr uint32_t kProducerCount = 4;
+    static constexpr uint32_t kEventsPerProducer = 20000;
+
+    ConcurrentEventQueue<QueuedEvent> queue(256);
+    EventBus bus;
+    QueueSubscriber subscriber;
+    bus.AddSource(&queue);
+    bus.Subscribe<QueuedEvent>(&subscriber);
+
+    std::atomic<uint32_t> finished = 0;
+    std::vector<std::thread> producers;
+
+    for (uint32_t producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back(
+            [&queue, &finished, producer]()
+            {
+                // Retries when full, so nothing is dropped
+                for (uint32_t i = 0; i < kEventsPerProducer; i++)
+                {
+                    const QueuedEvent event{.producer = producer,
+                                            .sequence = i};
+
+                    while (!queue.Push(event))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                finished++;
+            });
+    }
+
+    while (finished.load() < kProducerCount)
+    {
+        bus.Flush();
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    bus.Flush();
+    CHECK_EQ(subscriber.received.size(),
+             size_t(kProducerCount * kEventsPerProducer));
+
+    // Each producer's own events arrive in the order it pushed them
+    std::vector<uint32_t> next(kProducerCount, 0);
+
+    for (const QueuedEvent& event : subscriber.received)
+    {
+        CHECK_EQ(event.sequence, next[event.producer]);
+        next[event.producer]++;
+    }
+
+    bus.RemoveSource(&queue);
+}
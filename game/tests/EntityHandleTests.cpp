@@ -0,0 +1,94 @@
+#include <vector>
+
+#include "Test.h"
+#include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
+
+TEST_CASE(EntityHandleGoesStaleOnDestroy)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+
+    Entity& entity = scene.AddEntity("First");
+    const EntityHandle handle = entity.GetHandle();
+
+    CHECK(scene.IsAlive(handle));
+    CHECK_EQ(scene.GetEntity(handle), &entity);
+
+    // Destroying is deferred until the flush
+    scene.DestroyEntity(handle);
+    CHECK(scene.IsAlive(handle));
+
+    scene.FlushDestroyedEntities();
+    CHECK(!scene.IsAlive(handle));
+    CHECK(scene.GetEntity(handle) == nullptr);
+
+    // Reuses the slot with the next generation, the old handle stays stale
+    Entity& replacement = scene.AddEntity("Second");
+    const EntityHandle new_handle = replacement.GetHandle();
+
+    CHECK_EQ(new_handle.GetIndex(), handle.GetIndex());
+    CHECK_EQ(new_handle.GetGeneration(), handle.GetGeneration() + 1);
+    CHECK(!scene.IsAlive(handle));
+    CHECK(scene.GetEntity(handle) == nullptr);
+    CHECK_EQ(scene.GetEntity(new_handle), &replacement);
+}
+
+TEST_CASE(EntityHandleGenerationWraps)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+
+    EntityHandle handle = scene.AddEntity().GetHandle();
+    const uint32_t index = handle.GetIndex();
+
+    for (uint32_t i = 0; i < EntityHandle::kMaxGeneration; i++)
+    {
+        scene.DestroyEntity(handle);
+        scene.FlushDestroyedEntities();
+
+        handle = scene.AddEntity().GetHandle();
+        CHECK_EQ(handle.GetIndex(), index);
+        CHECK(handle.IsValid());
+        CHECK(handle.GetGeneration() < EntityHandle::kMaxGeneration);
+    }
+
+    // A full lap comes back around to the first generation
+    CHECK_EQ(handle.GetGeneration(), uint32_t(0));
+    CHECK(scene.IsAlive(handle));
+}
+
+TEST_CASE(EntityHandleSurvivesSwapRemove)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+
+    std::vector<EntityHandle> handles;
+    std::vector<Entity*> entities;
+
+    for (int i = 0; i < 8; i++)
+    {
+        Entity& entity = scene.AddEntity();
+        handles.push_back(entity.GetHandle());
+        entities.push_back(&entity);
+    }
+
+    // Destroying from the middle moves the last entity into the gap
+    scene.DestroyEntity(handles[2]);
+    scene.DestroyEntity(handles[5]);
+    scene.FlushDestroyedEntities();
+
+    CHECK_EQ(scene.GetEntities().size(), size_t(6));
+
+    for (size_t i = 0; i < handles.size(); i++)
+    {
+        if (i == 2 || i == 5)
+        {
+            CHECK(scene.GetEntity(handles[i]) == nullptr);
+        }
+        else
+        {
+            CHECK_EQ(scene.GetEntity(handles[i]), entities[i]);
+        }
+    }
+}
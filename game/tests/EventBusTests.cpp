@@ -0,0 +1,215 @@
+#include <vector>
+
+#include "Test.h"
+#include "engine/core/event/EventBus.h"
+
+struct TestEvent : public IEvent
+{
+    int value;
+};
+
+template <>
+class IEventSubscriber<TestEvent>
+{
+  public:
+    virtual void OnTestEvent(const TestEvent& event) = 0;
+};
+
+template <>
+inline void EventDispatcher::Dispatch<TestEvent>(
+    IEventSubscriber<TestEvent>* subscriber, const TestEvent* event)
+{
+    subscriber->OnTestEvent(*event);
+}
+
+// Runs the given action from inside its handler, on the first call only
+struct TestSubscriber : public IEventSubscriber<TestEvent>
+{
+    std::vector<int> received;
+    void (*action)(TestSubscriber&) = nullptr;
+
+    EventBus* bus = nullptr;
+    EventBus::SubscriptionId id{};
+    TestSubscriber* other = nullptr;
+
+    void OnTestEvent(const TestEvent& event) override
+    {
+        received.push_back(event.value);
+
+        if (action)
+        {
+            auto run = action;
+            action = nullptr;
+            run(*this);
+        }
+    }
+};
+
+static void Publish(EventBus& bus, int value)
+{
+    const TestEvent event{.value = value};
+    bus.Publish<TestEvent>(&event);
+}
+
+TEST_CASE(EventBusSubscribeDuringPublishWaits)
+{
+    EventBus bus;
+    TestSubscriber first, added;
+
+    first.bus = &bus;
+    first.other = &added;
+    first.action = [](TestSubscriber& self)
+    { self.bus->Subscribe<TestEvent>(self.other); };
+    bus.Subscribe<TestEvent>(&first);
+
+    Publish(bus, 1);
+    CHECK(added.received.empty());
+
+    Publish(bus, 2);
+    CHECK_EQ(added.received, (std::vector<int>{2}));
+}
+
+TEST_CASE(EventBusPostWaitsForFlush)
+{
+    EventBus bus;
+    EventBus downstream;
+    TestSubscriber subscriber, downstream_subscriber;
+
+    bus.SetDownstream(&downstream);
+    bus.Subscribe<TestEvent>(&subscriber);
+    downstream.Subscribe<TestEvent>(&downstream_subscriber);
+
+    bus.Post(TestEvent{.value = 1});
+    bus.Post(TestEvent{.value = 2});
+    bus.Post(TestEvent{.value = 3});
+    CHECK(subscriber.received.empty());
+
+    bus.Flush();
+    CHECK_EQ(subscriber.received, (std::vector<int>{1, 2, 3}));
+    CHECK_EQ(downstream_subscriber.received, (std::vector<int>{1, 2, 3}));
+
+    // Already delivered, so flushing again doesn't repeat them
+    bus.Flush();
+    CHECK_EQ(subscriber.received.size(), size_t(3));
+}
+
+TEST_CASE(EventBusPostFromHandlerWaitsForNextFlush)
+{
+    EventBus bus;
+    TestSubscriber subscriber;
+
+    subscriber.bus = &bus;
+    subscriber.action = [](TestSubscriber& self)
+    { self.bus->Post(TestEvent{.value = 2}); };
+    bus.Subscribe<TestEvent>(&subscriber);
+
+    bus.Post(TestEvent{.value = 1});
+    bus.Flush();
+    CHECK_EQ(subscriber.received, (std::vector<int>{1}));
+
+    bus.Flush();
+    CHECK_EQ(subscriber.received, (std::vector<int>{1, 2}));
+}
+
+TEST_CASE(EventBusUnsubscribeSelfDuringPublish)
+{
+    EventBus bus;
+    TestSubscriber first, second, third;
+
+    first.bus = &bus;
+    first.id = bus.Subscribe<TestEvent>(&first);
+    first.action = [](TestSubscriber& self) { self.bus->Unsubscribe(self.id); };
+    bus.Subscribe<TestEvent>(&second);
+    bus.Subscribe<TestEvent>(&third);
+
+    // Everyone else still gets the event it was removed during
+    Publish(bus, 1);
+    CHECK_EQ(first.received.size(), size_t(1));
+    CHECK_EQ(second.received.size(), size_t(1));
+    CHECK_EQ(third.received.size(), size_t(1));
+
+    Publish(bus, 2);
+    CHECK_EQ(first.received.size(), size_t(1));
+    CHECK_EQ(second.received, (std::vector<int>{1, 2}));
+    CHECK_EQ(third.received, (std::vector<int>{1, 2}));
+}
+
+TEST_CASE(EventBusUnsubscribeLaterSubscriberDuringPublish)
+{
+    EventBus bus;
+    TestSubscriber first, second, third;
+
+    first.bus = &bus;
+    first.other = &second;
+    first.action = [](TestSubscriber& self)
+    { self.bus->Unsubscribe(self.other->id); };
+    bus.Subscribe<TestEvent>(&first);
+    second.id = bus.Subscribe<TestEvent>(&second);
+    bus.Subscribe<TestEvent>(&third);
+
+    // Removed before its turn, so it isn't called even for this event
+    Publish(bus, 1);
+    CHECK(second.received.empty());
+    CHECK_EQ(first.received.size(), size_t(1));
+    CHECK_EQ(third.received.size(), size_t(1));
+
+    Publish(bus, 2);
+    CHECK(second.received.empty());
+    CHECK_EQ(third.received, (std::vector<int>{1, 2}));
+}
+
+TEST_CASE(EventBusIgnoresStaleIds)
+{
+    EventBus bus;
+    TestSubscriber removed, replacement, bystander;
+
+    const EventBus::SubscriptionId stale = bus.Subscribe<TestEvent>(&removed);
+    bus.Subscribe<TestEvent>(&bystander);
+    bus.Unsubscribe(stale);
+
+    // Takes over the freed slot with a newer generation
+    const EventBus::SubscriptionId id = bus.Subscribe<TestEvent>(&replacement);
+    CHECK_EQ(id.slot, stale.slot);
+    CHECK(id.generation != stale.generation);
+
+    bus.Unsubscribe(stale);
+    Publish(bus, 1);
+    CHECK(removed.received.empty());
+    CHECK_EQ(replacement.received.size(), size_t(1));
+    CHECK_EQ(bystander.received.size(), size_t(1));
+
+    // Cleared ids go stale too, and don't touch later subscribers
+    bus.ClearSubscribers();
+    const EventBus::SubscriptionId after_clear =
+        bus.Subscribe<TestEvent>(&removed);
+    bus.Unsubscribe(id);
+    Publish(bus, 2);
+    CHECK_EQ(removed.received, (std::vector<int>{2}));
+    CHECK_EQ(replacement.received.size(), size_t(1));
+
+    bus.Unsubscribe(after_clear);
+    bus.Unsubscribe(after_clear);
+    Publish(bus, 3);
+    CHECK_EQ(removed.received.size(), size_t(1));
+}
+
+TEST_CASE(EventBusStatsUseReadableTypeNames)
+{
+    EventBus bus;
+    TestSubscriber subscriber;
+
+    bus.SetStatsEnabled(true);
+    bus.Subscribe<TestEvent>(&subscriber);
+    Publish(bus, 1);
+    bus.CaptureStats();
+
+    const std::vector<EventBus::EventStats>& stats = bus.GetStats();
+    CHECK_EQ(stats.size(), size_t(1));
+
+    if (!stats.empty())
+    {
+        CHECK_EQ(stats[0].name, "TestEvent");
+        CHECK_EQ(stats[0].subscribers.size(), size_t(1));
+        CHECK_EQ(stats[0].subscribers[0].name, "TestSubscriber");
+    }
+}
@@ -0,0 +1,107 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "engine/core/jobs/JobSystem.h"
+
+TEST_CASE(JobSystemWaitSkipsBackgroundJobs)
+{
+    JobSystem job_system(2);
+    std::atomic<bool> released = false;
+    JobCounter background = 0;
+
+    // Both would block forever if a waiter picked one up
+    for (int i = 0; i < 2; i++)
+    {
+        job_system.SubmitBackground(
+            [&released]()
+            {
+                while (!released.load())
+                {
+                    std::this_thread::yield();
+                }
+            },
+            &background);
+    }
+
+    std::atomic<uint32_t> sum = 0;
+    JobCounter counter = 0;
+
+    for (uint32_t i = 1; i <= 100; i++)
+    {
+        job_system.Submit([&sum, i]() { sum += i; }, &counter);
+    }
+
+    job_system.Wait(counter);
+    CHECK_EQ(sum.load(), uint32_t(5050));
+    CHECK_EQ(background.load(), uint32_t(2));
+
+    released = true;
+    job_system.Wait(background);
+    CHECK_EQ(background.load(), uint32_t(0));
+}
+
+TEST_CASE(JobSystemWaitWakesForNewJobs)
+{
+    JobSystem job_system(1);
+    std::atomic<bool> helped = false;
+    JobCounter background = 0;
+
+    // The only worker is stuck until the waiter runs the job it submits
+    job_system.SubmitBackground(
+        [&job_system, &helped]()
+        {
+            job_system.Submit([&helped]() { helped = true; });
+
+            while (!helped.load())
+            {
+                std::this_thread::yield();
+            }
+        },
+        &background);
+
+    job_system.Wait(background);
+    CHECK(helped.load());
+    CHECK_EQ(background.load(), uint32_t(0));
+}
+
+TEST_CASE(JobSystemParallelForCoversRange)
+{
+    JobSystem job_system(3);
+    std::vector<std::atomic<uint32_t>> visits(10000);
+
+    for (int round = 0; round < 10; round++)
+    {
+        job_system.ParallelFor(visits.size(), 16,
+                               [&visits](size_t begin, size_t end)
+                               {
+                                   for (size_t i = begin; i < end; i++)
+                                   {
+                                       visits[i]++;
+                                   }
+                               });
+    }
+
+    bool all_visited = true;
+
+    for (const std::atomic<uint32_t>& count : visits)
+    {
+        all_visited = all_visited && count.load() == 10;
+    }
+
+    CHECK(all_visited);
+}
+
+TEST_CASE(JobSystemRunsInlineWithoutWorkers)
+{
+    JobSystem job_system(0);
+    JobCounter counter = 0;
+    int runs = 0;
+
+    job_system.Submit([&runs]() { runs++; }, &counter);
+    job_system.SubmitBackground([&runs]() { runs++; }, &counter);
+
+    CHECK_EQ(runs, 2);
+    CHECK_EQ(counter.load(), uint32_t(0));
+}
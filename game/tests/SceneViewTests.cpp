@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <vector>
+
+#include "Test.h"
+#include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
+
+template <int N>
+struct ViewComponent final : public Component
+{
+    void OnInit(const ServiceProvider& service_provider) override
+    {
+    }
+
+    std::string_view GetName() const override
+    {
+        return "ViewComponent";
+    }
+};
+
+using ViewA = ViewComponent<0>;
+using ViewB = ViewComponent<1>;
+
+static bool Contains(const std::vector<Entity*>& entities, const Entity* entity)
+{
+    return std::find(entities.begin(), entities.end(), entity) !=
+           entities.end();
+}
+
+template <class View>
+static std::vector<Entity*> Collect(const View& view)
+{
+    return std::vector<Entity*>(view.begin(), view.end());
+}
+
+TEST_CASE(SceneViewTracksComponentChanges)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+
+    Entity& both = scene.AddEntity("Both");
+    both.AddComponent<ViewA>();
+    both.AddComponent<ViewB>();
+
+    Entity& only_a = scene.AddEntity("OnlyA");
+    only_a.AddComponent<ViewA>();
+
+    // The first query scans what's already there
+    auto view = scene.View<ViewA, ViewB>();
+    CHECK_EQ(view.GetSize(), size_t(1));
+    CHECK(Contains(Collect(view), &both));
+
+    // Later changes are picked up without another scan
+    only_a.AddComponent<ViewB>();
+    CHECK_EQ(view.GetSize(), size_t(2));
+    CHECK(Contains(Collect(view), &only_a));
+
+    Entity& added = scene.AddEntity("Added");
+    added.AddComponent<ViewB>();
+    CHECK_EQ(view.GetSize(), size_t(2));
+    added.AddComponent<ViewA>();
+    CHECK_EQ(view.GetSize(), size_t(3));
+
+    both.Destroy();
+    scene.FlushDestroyedEntities();
+    CHECK_EQ(view.GetSize(), size_t(2));
+    CHECK(!Contains(Collect(view), &both));
+
+    size_t visited = 0;
+
+    view.ForEach(
+        [&](Entity& entity, ViewA& a, ViewB& b)
+        {
+            CHECK_EQ(&a.GetEntity(), &entity);
+            CHECK_EQ(&b.GetEntity(), &entity);
+            visited++;
+        });
+
+    CHECK_EQ(visited, size_t(2));
+}
+
+TEST_CASE(SceneViewsShareCachePerMask)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+
+    scene.AddEntity().AddComponent<ViewA>();
+
+    auto a_view = scene.View<ViewA>();
+    auto b_view = scene.View<ViewB>();
+    CHECK_EQ(a_view.GetSize(), size_t(1));
+    CHECK_EQ(b_view.GetSize(), size_t(0));
+
+    // Another view of the same types sees the same, already updated entities
+    scene.AddEntity().AddComponent<ViewA>();
+    CHECK_EQ(scene.View<ViewA>().GetSize(), size_t(2));
+    CHECK_EQ(a_view.GetSize(), size_t(2));
+}
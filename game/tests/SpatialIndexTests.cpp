@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/constants.hpp>
+#include <random>
+#include <vector>
+
+#include "Test.h"
+#include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
+#include "engine/scene/SpatialIndex.h"
+#include "engine/scene/Transform.h"
+
+static std::vector<Transform*> BruteForceRadius(
+    const std::vector<Transform*>& transforms, const glm::vec3& center,
+    float radius)
+{
+    std::vector<Transform*> found;
+
+    for (Transform* transform : transforms)
+    {
+        const glm::vec3 offset = transform->GetWorldPosition() - center;
+
+        if (glm::dot(offset, offset) <= radius * radius)
+        {
+            found.push_back(transform);
+        }
+    }
+
+    return found;
+}
+
+static std::vector<Transform*> BruteForceCone(
+    const std::vector<Transform*>& transforms, const glm::vec3& apex,
+    const glm::vec3& direction, float range, float half_angle)
+{
+    std::vector<Transform*> found;
+
+    for (Transform* transform : transforms)
+    {
+        const glm::vec3 offset = transform->GetWorldPosition() - apex;
+        const float distance = glm::length(offset);
+
+        if (distance <= range &&
+            glm::dot(offset, direction) >= std::cos(half_angle) * distance)
+        {
+            found.push_back(transform);
+        }
+    }
+
+    return found;
+}
+
+static bool SameElements(std::vector<Transform*> actual,
+                         std::vector<Transform*> expected)
+{
+    std::sort(actual.begin(), actual.end());
+    std::sort(expected.begin(), expected.end());
+    return actual == expected;
+}
+
+TEST_CASE(SpatialIndexFollowsMovedTransforms)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+    scene.Load();
+
+    SpatialIndex& index = scene.GetSpatialIndex();
+    Transform& transform = scene.AddEntity().AddComponent<Transform>();
+    transform.SetPosition(glm::vec3(0.0f, 0.0f, 0.0f));
+    index.Update();
+
+    std::vector<Transform*> found;
+    index.QueryRadius(glm::vec3(0.0f), 1.0f, found);
+    CHECK_EQ(found.size(), size_t(1));
+
+    // Queries see the old position until the next update
+    transform.SetPosition(glm::vec3(500.0f, 0.0f, -500.0f));
+    found.clear();
+    index.QueryRadius(glm::vec3(500.0f, 0.0f, -500.0f), 1.0f, found);
+    CHECK(found.empty());
+
+    index.Update();
+    found.clear();
+    index.QueryRadius(glm::vec3(0.0f), 1.0f, found);
+    CHECK(found.empty());
+    index.QueryRadius(glm::vec3(500.0f, 0.0f, -500.0f), 1.0f, found);
+    CHECK_EQ(found.size(), size_t(1));
+    CHECK_EQ(found[0], &transform);
+
+    // Destroyed entities leave the index right away
+    transform.GetEntity().Destroy();
+    scene.FlushDestroyedEntities();
+    CHECK_EQ(index.GetSize(), size_t(0));
+    found.clear();
+    index.QueryRadius(glm::vec3(500.0f, 0.0f, -500.0f), 1.0f, found);
+    CHECK(found.empty());
+
+    scene.Unload();
+}
+
+TEST_CASE(SpatialIndexMatchesBruteForce)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+    scene.Load();
+
+    std::mt19937 random(kTestSeed);
+    std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+    std::vector<Transform*> transforms;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        Transform& transform = scene.AddEntity().AddComponent<Transform>();
+        transform.SetPosition(
+            glm::vec3(coord(random), coord(random) * 0.1f, coord(random)));
+        transforms.push_back(&transform);
+    }
+
+    SpatialIndex& index = scene.GetSpatialIndex();
+    const glm::vec3 direction = glm::normalize(glm::vec3(1.0f, 0.0f, 1.0f));
+    const float half_angle = glm::radians(15.0f);
+
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 50; i++)
+        {
+            transforms[random() % transforms.size()]->SetPosition(
+                glm::vec3(coord(random), 0.0f, coord(random)));
+        }
+
+        for (int i = 0; i < 5; i++)
+        {
+            const size_t removed = random() % transforms.size();
+            transforms[removed]->GetEntity().Destroy();
+            transforms.erase(transforms.begin() + removed);
+        }
+
+        scene.FlushDestroyedEntities();
+        index.Update();
+        CHECK_EQ(index.GetSize(), transforms.size());
+
+        // Small queries walk the cells in range, huge ones the occupied cells
+        for (float radius : {0.0f, 40.0f, 2000.0f})
+        {
+            const glm::vec3 center(coord(random), 0.0f, coord(random));
+
+            std::vector<Transform*> found;
+            index.QueryRadius(center, radius, found);
+            CHECK(SameElements(found,
+                               BruteForceRadius(transforms, center, radius)));
+
+            found.clear();
+            index.QueryCone(center, direction, radius, half_angle, found);
+            CHECK(SameElements(found, BruteForceCone(transforms, center,
+                                                     direction, radius,
+                                                     half_angle)));
+        }
+    }
+
+    scene.Unload();
+    CHECK_EQ(index.GetSize(), size_t(0));
+}
+
+TEST_CASE(SpatialIndexHandlesExtremeQueries)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+    scene.Load();
+
+    SpatialIndex& index = scene.GetSpatialIndex();
+    Transform& near = scene.AddEntity().AddComponent<Transform>();
+    Transform& far = scene.AddEntity().AddComponent<Transform>();
+    near.SetPosition(glm::vec3(0.0f));
+    far.SetPosition(glm::vec3(1e12f, 0.0f, -1e12f));
+    index.Update();
+
+    // Past the edge of the grid, so these clamp instead of overflowing
+    std::vector<Transform*> found;
+    index.QueryRadius(glm::vec3(0.0f), INFINITY, found);
+    CHECK(SameElements(found, {&near, &far}));
+
+    found.clear();
+    index.QueryRadius(glm::vec3(0.0f), 1e30f, found);
+    CHECK(SameElements(found, {&near, &far}));
+
+    found.clear();
+    index.QueryRadius(glm::vec3(0.0f), NAN, found);
+    index.QueryRadius(glm::vec3(NAN), 10.0f, found);
+    CHECK(found.empty());
+
+    scene.Unload();
+}
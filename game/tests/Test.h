@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Fixed seed so every run generates the same inputs
+static constexpr uint32_t kTestSeed = 585;
+
+namespace test
+{
+using TestFunction = void (*)();
+
+struct TestCase
+{
+    const char* name;
+    TestFunction function;
+};
+
+std::vector<TestCase>& GetTestCases();
+bool Register(const char* name, TestFunction function);
+
+// Records the failure and keeps going, so one run reports every broken check
+void ReportFailure(const char* expression, const char* file, int line);
+}  // namespace test
+
+/**
+ * Defines a test case, registered before main runs:
+ *
+ *     TEST_CASE(SomethingWorks)
+ *     {
+ *         CHECK(Something());
+ *     }
+ */
+#define TEST_CASE(name)                                                       \
+    static void name();                                                       \
+    static const bool name##_registered = test::Register(#name, &name);      \
+    static void name()
+
+// Unlike ASSERT, stays on in release builds
+#define CHECK(expression)                                                     \
+    do                                                                        \
+    {                                                                         \
+        if (!(expression))                                                    \
+        {                                                                     \
+            test::ReportFailure(#expression, __FILE__, __LINE__);             \
+        }                                                                     \
+    } while (false)
+
+#define CHECK_EQ(actual, expected) CHECK((actual) == (expected))
@@ -0,0 +1,80 @@
+#include <fmt/format.h>
+
+#include <string>
+
+#include "Test.h"
+
+using std::string;
+
+static uint32_t kFailureCount = 0;
+
+namespace test
+{
+std::vector<TestCase>& GetTestCases()
+{
+    // Function local, so it exists before any file's registrations run
+    static std::vector<TestCase> test_cases;
+    return test_cases;
+}
+
+bool Register(const char* name, TestFunction function)
+{
+    GetTestCases().push_back(TestCase{.name = name, .function = function});
+    return true;
+}
+
+void ReportFailure(const char* expression, const char* file, int line)
+{
+    fmt::print("  {}:{}: CHECK({}) failed\n", file, line, expression);
+    kFailureCount++;
+}
+}  // namespace test
+
+/**
+ * Usage: game_tests [--filter <substring>]
+ *
+ * Exits with a non-zero status if any check failed
+ */
+int main(int argc, char* argv[])
+{
+    string filter;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const string arg = argv[i];
+
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else
+        {
+            fmt::print("Ignoring unknown argument: {}\n", arg);
+        }
+    }
+
+    uint32_t run_count = 0;
+    uint32_t failed_count = 0;
+
+    for (const test::TestCase& test_case : test::GetTestCases())
+    {
+        if (!filter.empty() &&
+            string(test_case.name).find(filter) == string::npos)
+        {
+            continue;
+        }
+
+        const uint32_t failures_before = kFailureCount;
+        test_case.function();
+        run_count++;
+
+        const bool passed = kFailureCount == failures_before;
+        failed_count += passed ? 0 : 1;
+        fmt::print("[{}] {}\n", passed ? " OK " : "FAIL", test_case.name);
+    }
+
+    fmt::print("{}/{} test cases passed\n", run_count - failed_count,
+               run_count);
+
+    return failed_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+#include <glm/gtc/epsilon.hpp>
+
+#include "Test.h"
+#include "engine/scene/Entity.h"
+#include "engine/scene/Scene.h"
+#include "engine/scene/Transform.h"
+
+static constexpr float kEpsilon = 0.0001f;
+
+static bool NearlyEqual(const glm::vec3& actual, const glm::vec3& expected)
+{
+    return glm::all(glm::epsilonEqual(actual, expected, kEpsilon));
+}
+
+static Transform& AddTransform(Scene& scene, const glm::vec3& position)
+{
+    Transform& transform = scene.AddEntity().AddComponent<Transform>();
+    transform.SetPosition(position);
+    return transform;
+}
+
+TEST_CASE(TransformHierarchyComposesParents)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+    scene.Load();
+
+    Transform& parent = AddTransform(scene, glm::vec3(10.0f, 0.0f, 0.0f));
+    Transform& child = AddTransform(scene, glm::vec3(1.0f, 0.0f, 0.0f));
+    Transform& grandchild = AddTransform(scene, glm::vec3(0.0f, 0.0f, 1.0f));
+
+    // Linked bottom up, so the update has to sort them first
+    grandchild.SetParent(&child);
+    child.SetParent(&parent);
+    scene.GetTransformHierarchy().Update();
+
+    CHECK_EQ(scene.GetTransformHierarchy().GetSize(), size_t(3));
+    CHECK_EQ(child.GetParent(), &parent);
+    CHECK(NearlyEqual(child.GetWorldPosition(), glm::vec3(11.0f, 0.0f, 0.0f)));
+    CHECK(NearlyEqual(grandchild.GetWorldPosition(),
+                      glm::vec3(11.0f, 0.0f, 1.0f)));
+
+    // Children follow the parent on the next update
+    parent.SetPosition(glm::vec3(0.0f, 5.0f, 0.0f));
+    scene.GetTransformHierarchy().Update();
+    CHECK(NearlyEqual(child.GetWorldPosition(), glm::vec3(1.0f, 5.0f, 0.0f)));
+    CHECK(NearlyEqual(grandchild.GetWorldPosition(),
+                      glm::vec3(1.0f, 5.0f, 1.0f)));
+
+    // Rotating the parent a quarter turn about Y swings the children around
+    parent.RotateEulerDegrees(glm::vec3(0.0f, 90.0f, 0.0f));
+    scene.GetTransformHierarchy().Update();
+    CHECK(NearlyEqual(child.GetWorldPosition(), glm::vec3(0.0f, 5.0f, -1.0f)));
+    CHECK(NearlyEqual(grandchild.GetWorldPosition(),
+                      glm::vec3(1.0f, 5.0f, -1.0f)));
+
+    scene.Unload();
+}
+
+TEST_CASE(TransformHierarchySkipsUnchangedSubtrees)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+    scene.Load();
+
+    Transform& parent = AddTransform(scene, glm::vec3(10.0f, 0.0f, 0.0f));
+    Transform& child = AddTransform(scene, glm::vec3(1.0f, 0.0f, 0.0f));
+    child.SetParent(&parent);
+    scene.GetTransformHierarchy().Update();
+
+    const uint32_t version = child.GetWorldVersion();
+    scene.GetTransformHierarchy().Update();
+    CHECK_EQ(child.GetWorldVersion(), version);
+
+    parent.Translate(glm::vec3(1.0f, 0.0f, 0.0f));
+    scene.GetTransformHierarchy().Update();
+    CHECK(child.GetWorldVersion() != version);
+
+    scene.Unload();
+}
+
+TEST_CASE(TransformHierarchyDetachKeepsPose)
+{
+    ServiceProvider service_provider;
+    Scene scene("Test", service_provider);
+    scene.Load();
+
+    Transform& parent = AddTransform(scene, glm::vec3(10.0f, 0.0f, 0.0f));
+    Transform& child = AddTransform(scene, glm::vec3(1.0f, 0.0f, 0.0f));
+    Transform& other = AddTransform(scene, glm::vec3(2.0f, 0.0f, 0.0f));
+    child.SetParent(&parent);
+    other.SetParent(&parent);
+    scene.GetTransformHierarchy().Update();
+
+    // Unparenting keeps the local pose, which is now the world pose
+    other.SetParent(nullptr);
+    scene.GetTransformHierarchy().Update();
+    CHECK(other.GetParent() == nullptr);
+    CHECK(NearlyEqual(other.GetWorldPosition(), glm::vec3(2.0f, 0.0f, 0.0f)));
+
+    // Destroying the parent leaves its children where they were in the world
+    parent.GetEntity().Destroy();
+    scene.FlushDestroyedEntities();
+    scene.GetTransformHierarchy().Update();
+    CHECK(child.GetParent() == nullptr);
+    CHECK(NearlyEqual(child.GetWorldPosition(), glm::vec3(11.0f, 0.0f, 0.0f)));
+    CHECK_EQ(scene.GetTransformHierarchy().GetSize(), size_t(0));
+
+    scene.Unload();
+}